@@ -0,0 +1,79 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include "big_integer.hpp"
+#include <random>
+#include <string>
+#include <array>
+
+using namespace hsc_snippets;
+
+namespace {
+    // Operand sizes in decimal digits. The million-digit runs live in the hidden [huge] test case below.
+    constexpr std::array<std::size_t, 5> SIZES = {10, 100, 1000, 10000, 100000};
+    constexpr std::size_t HUGE_SIZE = 1000000;
+
+    std::string randomDigits(std::size_t digits, std::uint64_t seed) {
+        std::mt19937_64 rng(seed);
+        std::string str(digits, '0');
+        for (char &c: str) {
+            c = static_cast<char>('0' + rng() % 10);
+        }
+        str[0] = static_cast<char>('1' + rng() % 9);
+        return str;
+    }
+
+    BigInteger randomNumber(std::size_t digits, std::uint64_t seed) {
+        return BigInteger::parse(randomDigits(digits, seed));
+    }
+
+    // Exponent n such that 3^n has about the given number of digits
+    unsigned int powerExponent(std::size_t digits) {
+        return static_cast<unsigned int>(static_cast<double>(digits) / 0.47712125472);
+    }
+
+    void benchmarkAll(std::size_t digits) {
+        const BigInteger a = randomNumber(digits, 1);
+        const BigInteger b = randomNumber(digits, 2);
+        const BigInteger wide = randomNumber(2 * digits, 3);
+        const std::string text = randomDigits(digits, 4);
+        const std::string suffix = " (" + std::to_string(digits) + " digits)";
+
+        BENCHMARK("add" + suffix) {
+            return a + b;
+        };
+        BENCHMARK("multiply" + suffix) {
+            return a * b;
+        };
+        BENCHMARK("square" + suffix) {
+            return a * a;
+        };
+        BENCHMARK("divide" + suffix) {
+            return wide / a;
+        };
+        BENCHMARK("gcd" + suffix) {
+            return BigInteger::gcd(a, b);
+        };
+        BENCHMARK("pow" + suffix) {
+            return BigInteger::pow(BigInteger::from_integer(3), powerExponent(digits));
+        };
+        BENCHMARK("sqrt" + suffix) {
+            return BigInteger::sqrt(wide);
+        };
+        BENCHMARK("to_string" + suffix) {
+            return a.to_string();
+        };
+        BENCHMARK("parse" + suffix) {
+            return BigInteger::parse(text);
+        };
+    }
+}
+
+TEST_CASE("BigInteger operations", "[BigInteger]") {
+    for (std::size_t digits: SIZES) {
+        benchmarkAll(digits);
+    }
+}
+
+TEST_CASE("BigInteger operations at a million digits", "[BigInteger][.huge]") {
+    benchmarkAll(HUGE_SIZE);
+}
@@ -0,0 +1,91 @@
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include "rational_number.hpp"
+#include <array>
+#include <string>
+#include <vector>
+
+using namespace hsc_snippets;
+
+namespace {
+    // Chain lengths. Intermediate results grow with the chain, so the longest runs live in the hidden [huge] test case.
+    constexpr std::array<int, 3> LENGTHS = {10, 100, 1000};
+    constexpr int HUGE_LENGTH = 10000;
+
+    RationalNumber fraction(long long nominator, long long denominator) {
+        return RationalNumber::create(BigInteger::from_integer(nominator), BigInteger::from_integer(denominator));
+    }
+
+    void benchmarkChains(int length) {
+        const std::string suffix = " (" + std::to_string(length) + " terms)";
+
+        // 1 + 1/2 + ... + 1/n: denominators grow like lcm(1..n)
+        BENCHMARK("harmonic sum" + suffix) {
+            RationalNumber sum = RationalNumber::zero();
+            for (int k = 1; k <= length; ++k) {
+                sum += fraction(1, k);
+            }
+            return sum;
+        };
+
+        // The same sum over a balanced tree, reduced once
+        std::vector<RationalNumber> terms;
+        for (int k = 1; k <= length; ++k) {
+            terms.push_back(fraction(1, k));
+        }
+        BENCHMARK("harmonic tree sum" + suffix) {
+            return RationalNumber::sum(terms);
+        };
+
+        // 1 - 1/2 + 1/3 - ...: alternating signs exercise subtraction
+        BENCHMARK("alternating sum" + suffix) {
+            RationalNumber sum = RationalNumber::zero();
+            for (int k = 1; k <= length; ++k) {
+                if (k % 2 == 1) {
+                    sum += fraction(1, k);
+                } else {
+                    sum -= fraction(1, k);
+                }
+            }
+            return sum;
+        };
+
+        // prod (k + 1) / (k + 2): almost everything cancels, so the cost is dominated by reduction
+        BENCHMARK("telescoping product" + suffix) {
+            RationalNumber product = RationalNumber::one();
+            for (int k = 1; k <= length; ++k) {
+                product *= fraction(k + 1, k + 2);
+            }
+            return product;
+        };
+
+        // Continued fraction 1 + 1/(1 + 1/(...)): ratios of consecutive Fibonacci numbers
+        BENCHMARK("continued fraction" + suffix) {
+            RationalNumber value = RationalNumber::one();
+            for (int k = 1; k <= length; ++k) {
+                value = RationalNumber::one() + value.inverse();
+            }
+            return value;
+        };
+
+        // Pairwise comparisons between neighbouring harmonic partial sums
+        RationalNumber smaller = RationalNumber::zero();
+        for (int k = 1; k < length; ++k) {
+            smaller += fraction(1, k);
+        }
+        const RationalNumber larger = smaller + fraction(1, length);
+        BENCHMARK("compare" + suffix) {
+            return smaller < larger;
+        };
+    }
+}
+
+TEST_CASE("RationalNumber arithmetic chains", "[RationalNumber]") {
+    for (int length: LENGTHS) {
+        benchmarkChains(length);
+    }
+}
+
+TEST_CASE("RationalNumber arithmetic chains at ten thousand terms", "[RationalNumber][.huge]") {
+    benchmarkChains(HUGE_LENGTH);
+}
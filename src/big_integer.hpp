@@ -1,7 +1,7 @@
 #ifndef BIG_INTEGER_H
 #define BIG_INTEGER_H
 
-#include <ranges>
+#include "number_utils.hpp"
 #include <vector>
 #include <string>
 #include <algorithm>
@@ -10,6 +10,33 @@
 #include <optional>
 #include <iostream>
 #include <numeric>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <bit>
+#include <initializer_list>
+#include <iterator>
+#include <tuple>
+#include <functional>
+#include <cmath>
+#include <memory_resource>
+#include <span>
+#include <cstddef>
+#include <cstring>
+#include <future>
+#include <thread>
+#include <mutex>
+#include <map>
+#include <array>
+
+// The AVX2 limb kernels are compiled with function-level target attributes and selected at run time, so the header
+// needs no special compiler flags and still runs on processors without AVX2.
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#include <immintrin.h>
+#define HSC_BIG_INTEGER_AVX2_DISPATCH 1
+#else
+#define HSC_BIG_INTEGER_AVX2_DISPATCH 0
+#endif
 
 namespace hsc_snippets {
     /**
@@ -18,121 +45,2061 @@ namespace hsc_snippets {
      *
      * This class supports basic arithmetic operations, comparison, and conversion from/to strings and native integer types.
      * It handles both positive and negative large integer values.
+     *
+     * The magnitude is stored as little-endian base-2^32 limbs (sign-magnitude representation). Zero has no limbs
+     * and is never negative. Decimal text is only produced/consumed by `parse` and `to_string`, which convert
+     * between the two bases in chunks of 9 decimal digits, splitting large values by powers 10^(9 * 2^k) first.
+     * Values of up to 128 bits keep their limbs inline and never touch the heap; addition and multiplication of such
+     * values take word-sized fast paths.
+     *
+     * Longer limb buffers come from the global operator new unless a std::pmr::memory_resource is supplied (see
+     * `resource()`). Arithmetic results allocate from the resource of the (left) operand they derive from. Copy
+     * construction uses the global operator new, like std::pmr containers do, and assignment keeps the resource of the
+     * target, so a value copied or stored out of a short-lived arena never keeps pointing into it; copying into a
+     * resource is explicit (`BigInteger(other, resource)`).
      */
     class BigInteger {
     private:
-        std::vector<std::uint8_t> digits;
+        using Limb = std::uint32_t;
+        using DoubleLimb = std::uint64_t;
+
+        static constexpr int LIMB_BITS = 32;
+
+        // Largest power of ten that fits into a single limb, used for chunked radix conversion
+        static constexpr Limb DECIMAL_CHUNK = 1000000000;
+        static constexpr int DECIMAL_CHUNK_DIGITS = 9;
+
+        /*
+         * Limb storage with a small inline buffer. Values of up to INLINE_CAPACITY limbs (128 bits) live inside the
+         * object; longer values spill to a heap block that grows geometrically and is kept when the value shrinks.
+         * Heap blocks come from `memoryResource`, or from operator new[] when it is null. Copy construction uses operator
+         * new[] unless a resource is given, assignment keeps the resource of the target, and moving between different
+         * resources copies.
+         */
+        class LimbBuffer {
+        public:
+            static constexpr std::size_t INLINE_CAPACITY = 4;
+
+            LimbBuffer() = default;
+
+            explicit LimbBuffer(std::pmr::memory_resource *resource)
+                : memoryResource(resource == std::pmr::new_delete_resource() ? nullptr : resource) {
+            }
+
+            LimbBuffer(std::initializer_list<Limb> values) {
+                assign(values.begin(), values.end());
+            }
+
+            LimbBuffer(const LimbBuffer &other) {
+                assign(other.begin(), other.end());
+            }
+
+            LimbBuffer(const LimbBuffer &other, std::pmr::memory_resource *resource) : LimbBuffer(resource) {
+                assign(other.begin(), other.end());
+            }
+
+            LimbBuffer(LimbBuffer &&other) noexcept : memoryResource(other.memoryResource) {
+                steal(other);
+            }
+
+            LimbBuffer &operator=(const LimbBuffer &other) {
+                if (this != &other) {
+                    assign(other.begin(), other.end());
+                }
+                return *this;
+            }
+
+            LimbBuffer &operator=(LimbBuffer &&other) {
+                if (this == &other) {
+                    return *this;
+                }
+                if (memoryResource == other.memoryResource) {
+                    release();
+                    steal(other);
+                } else {
+                    assign(other.begin(), other.end());
+                }
+                return *this;
+            }
+
+            ~LimbBuffer() {
+                release();
+            }
+
+            [[nodiscard]] std::size_t size() const { return length; }
+            [[nodiscard]] bool empty() const { return length == 0; }
+            [[nodiscard]] std::size_t capacity() const { return allocated; }
+            [[nodiscard]] bool isInline() const { return heapLimbs == nullptr; }
+
+            Limb *data() { return heapLimbs != nullptr ? heapLimbs : inlineLimbs; }
+            [[nodiscard]] const Limb *data() const { return heapLimbs != nullptr ? heapLimbs : inlineLimbs; }
+            Limb *begin() { return data(); }
+            Limb *end() { return data() + length; }
+            [[nodiscard]] const Limb *begin() const { return data(); }
+            [[nodiscard]] const Limb *end() const { return data() + length; }
+            Limb &operator[](std::size_t i) { return data()[i]; }
+            const Limb &operator[](std::size_t i) const { return data()[i]; }
+            Limb &back() { return data()[length - 1]; }
+            [[nodiscard]] const Limb &back() const { return data()[length - 1]; }
+
+            void reserve(std::size_t n) {
+                if (n > allocated) {
+                    grow(n);
+                }
+            }
+
+            void resize(std::size_t n, Limb value = 0) {
+                reserve(n);
+                if (n > length) {
+                    std::fill(data() + length, data() + n, value);
+                }
+                length = n;
+            }
+
+            void assign(std::size_t n, Limb value) {
+                length = 0;
+                resize(n, value);
+            }
+
+            // The source range may lie inside this buffer as long as it does not need to grow.
+            template<typename Iterator>
+            void assign(Iterator first, Iterator last) {
+                auto n = static_cast<std::size_t>(std::distance(first, last));
+                if (n > allocated) {
+                    length = 0;
+                    grow(n);
+                }
+                std::copy(first, last, data());
+                length = n;
+            }
+
+            void push_back(Limb value) {
+                if (length == allocated) {
+                    grow(length + 1);
+                }
+                data()[length++] = value;
+            }
+
+            void pop_back() { --length; }
+
+            void clear() { length = 0; }
+
+            bool operator==(const LimbBuffer &other) const {
+                return length == other.length && std::equal(begin(), end(), other.begin());
+            }
+
+            // The resource heap blocks come from; null stands for operator new[].
+            [[nodiscard]] std::pmr::memory_resource *resource() const { return memoryResource; }
+
+        private:
+            Limb *heapLimbs = nullptr;
+            std::size_t length = 0;
+            std::size_t allocated = INLINE_CAPACITY;
+            std::pmr::memory_resource *memoryResource = nullptr;
+            Limb inlineLimbs[INLINE_CAPACITY]{};
+
+            Limb *allocate(std::size_t n) {
+                if (memoryResource == nullptr) {
+                    return new Limb[n];
+                }
+                return static_cast<Limb *>(memoryResource->allocate(n * sizeof(Limb), alignof(Limb)));
+            }
+
+            void deallocate(Limb *block, std::size_t n) {
+                if (memoryResource == nullptr) {
+                    delete[] block;
+                } else if (block != nullptr) {
+                    memoryResource->deallocate(block, n * sizeof(Limb), alignof(Limb));
+                }
+            }
+
+            void grow(std::size_t n) {
+                n = std::max(n, 2 * allocated);
+                Limb *block = allocate(n);
+                std::copy(begin(), end(), block);
+                deallocate(heapLimbs, allocated);
+                heapLimbs = block;
+                allocated = n;
+            }
+
+            void release() {
+                deallocate(heapLimbs, allocated);
+                heapLimbs = nullptr;
+                allocated = INLINE_CAPACITY;
+                length = 0;
+            }
+
+            void steal(LimbBuffer &other) {
+                if (other.heapLimbs != nullptr) {
+                    heapLimbs = other.heapLimbs;
+                    allocated = other.allocated;
+                    other.heapLimbs = nullptr;
+                    other.allocated = INLINE_CAPACITY;
+                } else {
+                    std::copy(other.inlineLimbs, other.inlineLimbs + other.length, inlineLimbs);
+                }
+                length = other.length;
+                other.length = 0;
+            }
+        };
+
+        LimbBuffer limbs;
         bool isNegative = false;
 
-        // Helper function to remove leading zeros
-        void removeLeadingZeros() {
-            while (digits.size() > 1 && digits.back() == 0) {
-                digits.pop_back();
+        // Helper function to remove leading zero limbs
+        void removeLeadingZeros() {
+            while (!limbs.empty() && limbs.back() == 0) {
+                limbs.pop_back();
+            }
+            if (limbs.empty()) {
+                isNegative = false; // Ensure 0 is always positive
+            }
+        }
+
+#pragma region simd kernels
+
+        // Operand size (in limbs) from which the vector kernels are worth the dispatch check.
+        static constexpr std::size_t SIMD_MIN_LIMBS = 16;
+
+#if HSC_BIG_INTEGER_AVX2_DISPATCH
+        static bool _hasAvx2() {
+            static const bool supported = __builtin_cpu_supports("avx2");
+            return supported;
+        }
+
+        /*
+         * Resolves the carries of eight lane-wise sums (or borrows of differences) at once. Bit i of `generated` marks a
+         * lane that produces a carry by itself and bit i of `propagate` one that passes an incoming carry on; the two
+         * sets are disjoint, so a single integer addition ripples the carries through the lanes. Returns the lanes
+         * that receive a carry and leaves the carry out of the top lane in `carry`.
+         */
+        static unsigned int _resolveCarries(unsigned int generated, unsigned int propagate, Limb &carry) {
+            const unsigned int sum = ((generated << 1) | carry) + propagate;
+            carry = sum >> 8;
+            return (sum ^ propagate) & 0xFF;
+        }
+
+        // Expands the low eight bits of mask into all-ones lanes.
+        __attribute__((target("avx2")))
+        static __m256i _laneMask(unsigned int mask) {
+            const __m256i laneBits = _mm256_setr_epi32(1, 2, 4, 8, 16, 32, 64, 128);
+            return _mm256_cmpeq_epi32(_mm256_and_si256(_mm256_set1_epi32(static_cast<int>(mask)), laneBits), laneBits);
+        }
+
+        __attribute__((target("avx2")))
+        static unsigned int _movemask(__m256i lanes) {
+            return static_cast<unsigned int>(_mm256_movemask_ps(_mm256_castsi256_ps(lanes)));
+        }
+
+        // r[0..n) = a + b + carry for n a multiple of 8; returns the outgoing carry. r may alias a or b.
+        __attribute__((target("avx2")))
+        static Limb _addLimbsAvx2(Limb *r, const Limb *a, const Limb *b, std::size_t n, Limb carry) {
+            const __m256i signBit = _mm256_set1_epi32(std::numeric_limits<std::int32_t>::min());
+            const __m256i allOnes = _mm256_set1_epi32(-1);
+            for (std::size_t i = 0; i < n; i += 8) {
+                const __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(a + i));
+                const __m256i y = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(b + i));
+                const __m256i sum = _mm256_add_epi32(x, y);
+                // The sum wrapped iff it is below x as unsigned; a lane of all ones passes an incoming carry on
+                const __m256i wrapped = _mm256_cmpgt_epi32(_mm256_xor_si256(x, signBit), _mm256_xor_si256(sum, signBit));
+                const unsigned int incoming = _resolveCarries(_movemask(wrapped),
+                                                              _movemask(_mm256_cmpeq_epi32(sum, allOnes)), carry);
+                _mm256_storeu_si256(reinterpret_cast<__m256i *>(r + i), _mm256_sub_epi32(sum, _laneMask(incoming)));
+            }
+            return carry;
+        }
+
+        // r[0..n) = a - b - borrow for n a multiple of 8; returns the outgoing borrow. r may alias a or b.
+        __attribute__((target("avx2")))
+        static Limb _subtractLimbsAvx2(Limb *r, const Limb *a, const Limb *b, std::size_t n, Limb borrow) {
+            const __m256i signBit = _mm256_set1_epi32(std::numeric_limits<std::int32_t>::min());
+            const __m256i zero = _mm256_setzero_si256();
+            for (std::size_t i = 0; i < n; i += 8) {
+                const __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(a + i));
+                const __m256i y = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(b + i));
+                const __m256i difference = _mm256_sub_epi32(x, y);
+                // The difference wrapped iff y is above x as unsigned; a zero lane passes an incoming borrow on
+                const __m256i wrapped = _mm256_cmpgt_epi32(_mm256_xor_si256(y, signBit), _mm256_xor_si256(x, signBit));
+                const unsigned int incoming = _resolveCarries(_movemask(wrapped),
+                                                              _movemask(_mm256_cmpeq_epi32(difference, zero)), borrow);
+                _mm256_storeu_si256(reinterpret_cast<__m256i *>(r + i), _mm256_add_epi32(difference, _laneMask(incoming)));
+            }
+            return borrow;
+        }
+
+        // Compares a[0..n) with b[0..n) eight limbs at a time from the top; returns -1, 0 or 1.
+        __attribute__((target("avx2")))
+        static int _compareLimbsAvx2(const Limb *a, const Limb *b, std::size_t n) {
+            std::size_t i = n;
+            for (; i >= 8; i -= 8) {
+                const __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(a + i - 8));
+                const __m256i y = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(b + i - 8));
+                const unsigned int equal = _movemask(_mm256_cmpeq_epi32(x, y));
+                if (equal != 0xFF) {
+                    const std::size_t top = i - 8 + (31 - static_cast<std::size_t>(std::countl_zero(~equal & 0xFF)));
+                    return a[top] < b[top] ? -1 : 1;
+                }
+            }
+            while (i-- > 0) {
+                if (a[i] != b[i]) {
+                    return a[i] < b[i] ? -1 : 1;
+                }
+            }
+            return 0;
+        }
+#endif
+
+#pragma endregion
+
+#pragma region limb kernels
+
+        // Compares two magnitudes, returns -1, 0 or 1. Both inputs must be free of leading zero limbs.
+        static int _compareLimbs(const Limb *a, std::size_t na, const Limb *b, std::size_t nb) {
+            if (na != nb) {
+                return na < nb ? -1 : 1;
+            }
+#if HSC_BIG_INTEGER_AVX2_DISPATCH
+            if (na >= SIMD_MIN_LIMBS && _hasAvx2()) {
+                return _compareLimbsAvx2(a, b, na);
+            }
+#endif
+            for (std::size_t i = na; i-- > 0;) {
+                if (a[i] != b[i]) {
+                    return a[i] < b[i] ? -1 : 1;
+                }
+            }
+            return 0;
+        }
+
+        // r[0..na) = a + b, requires na >= nb; returns the outgoing carry. r may alias a.
+        static Limb _addLimbs(Limb *r, const Limb *a, std::size_t na, const Limb *b, std::size_t nb) {
+            DoubleLimb carry = 0;
+            std::size_t i = 0;
+#if HSC_BIG_INTEGER_AVX2_DISPATCH
+            if (nb >= SIMD_MIN_LIMBS && _hasAvx2()) {
+                i = nb & ~std::size_t{7};
+                carry = _addLimbsAvx2(r, a, b, i, 0);
+            }
+#endif
+            for (; i < nb; ++i) {
+                carry += static_cast<DoubleLimb>(a[i]) + b[i];
+                r[i] = static_cast<Limb>(carry);
+                carry >>= LIMB_BITS;
+            }
+            for (; i < na; ++i) {
+                carry += a[i];
+                r[i] = static_cast<Limb>(carry);
+                carry >>= LIMB_BITS;
+            }
+            return static_cast<Limb>(carry);
+        }
+
+        // r[0..na) = a - b, requires na >= nb; returns the outgoing borrow. r may alias a.
+        static Limb _subtractLimbs(Limb *r, const Limb *a, std::size_t na, const Limb *b, std::size_t nb) {
+            Limb borrow = 0;
+            std::size_t i = 0;
+#if HSC_BIG_INTEGER_AVX2_DISPATCH
+            if (nb >= SIMD_MIN_LIMBS && _hasAvx2()) {
+                i = nb & ~std::size_t{7};
+                borrow = _subtractLimbsAvx2(r, a, b, i, 0);
+            }
+#endif
+            for (; i < nb; ++i) {
+                DoubleLimb diff = static_cast<DoubleLimb>(a[i]) - b[i] - borrow;
+                r[i] = static_cast<Limb>(diff);
+                borrow = static_cast<Limb>((diff >> LIMB_BITS) & 1);
+            }
+            for (; i < na; ++i) {
+                DoubleLimb diff = static_cast<DoubleLimb>(a[i]) - borrow;
+                r[i] = static_cast<Limb>(diff);
+                borrow = static_cast<Limb>((diff >> LIMB_BITS) & 1);
+            }
+            return borrow;
+        }
+
+        // r[0..rn) += a[0..an), requires an <= rn and the sum to fit in rn limbs.
+        static void _addInto(Limb *r, std::size_t rn, const Limb *a, std::size_t an) {
+            Limb carry = _addLimbs(r, r, an, a, an);
+            for (std::size_t i = an; carry != 0 && i < rn; ++i) {
+                carry = ++r[i] == 0 ? 1 : 0;
+            }
+        }
+
+        // r[0..n) += a * m; returns the outgoing carry limb.
+        static Limb _addMulLimb(Limb *r, const Limb *a, std::size_t n, Limb m) {
+            DoubleLimb carry = 0;
+            for (std::size_t i = 0; i < n; ++i) {
+                carry += static_cast<DoubleLimb>(a[i]) * m + r[i];
+                r[i] = static_cast<Limb>(carry);
+                carry >>= LIMB_BITS;
+            }
+            return static_cast<Limb>(carry);
+        }
+
+        // r[0..n) -= a * m; returns the limb still to be subtracted from r[n].
+        static Limb _subMulLimb(Limb *r, const Limb *a, std::size_t n, Limb m) {
+            DoubleLimb carry = 0;
+            for (std::size_t i = 0; i < n; ++i) {
+                const DoubleLimb product = static_cast<DoubleLimb>(a[i]) * m + carry;
+                const auto low = static_cast<Limb>(product);
+                carry = (product >> LIMB_BITS) + (r[i] < low ? 1 : 0);
+                r[i] -= low;
+            }
+            return static_cast<Limb>(carry);
+        }
+
+        // r[0..na+nb) = a * b using the schoolbook algorithm. r must not alias a or b.
+        static void _multiplySchoolbook(Limb *r, const Limb *a, std::size_t na, const Limb *b, std::size_t nb) {
+            std::fill(r, r + na + nb, 0);
+            for (std::size_t i = 0; i < na; ++i) {
+                r[i + nb] = _addMulLimb(r + i, b, nb, a[i]);
+            }
+        }
+
+        // r[0..2n) = a * a, computing every cross product once and doubling it. r must not alias a.
+        static void _squareSchoolbook(Limb *r, const Limb *a, std::size_t n) {
+            std::fill(r, r + 2 * n, 0);
+            for (std::size_t i = 0; i < n; ++i) {
+                DoubleLimb carry = 0;
+                const DoubleLimb ai = a[i];
+                for (std::size_t j = i + 1; j < n; ++j) {
+                    carry += ai * a[j] + r[i + j];
+                    r[i + j] = static_cast<Limb>(carry);
+                    carry >>= LIMB_BITS;
+                }
+                r[i + n] = static_cast<Limb>(carry);
+            }
+
+            // Double the cross products and add the diagonal squares
+            Limb shifted = 0;
+            for (std::size_t i = 0; i < 2 * n; ++i) {
+                Limb next = r[i] >> (LIMB_BITS - 1);
+                r[i] = (r[i] << 1) | shifted;
+                shifted = next;
+            }
+            DoubleLimb carry = 0;
+            for (std::size_t i = 0; i < n; ++i) {
+                DoubleLimb square = static_cast<DoubleLimb>(a[i]) * a[i];
+                carry += static_cast<DoubleLimb>(r[2 * i]) + static_cast<Limb>(square);
+                r[2 * i] = static_cast<Limb>(carry);
+                carry >>= LIMB_BITS;
+                carry += static_cast<DoubleLimb>(r[2 * i + 1]) + (square >> LIMB_BITS);
+                r[2 * i + 1] = static_cast<Limb>(carry);
+                carry >>= LIMB_BITS;
+            }
+        }
+
+        // a = a * m + add in place; returns the outgoing carry limb.
+        static Limb _multiplyAddSmall(Limb *a, std::size_t n, Limb m, Limb add) {
+            DoubleLimb carry = add;
+            for (std::size_t i = 0; i < n; ++i) {
+                carry += static_cast<DoubleLimb>(a[i]) * m;
+                a[i] = static_cast<Limb>(carry);
+                carry >>= LIMB_BITS;
+            }
+            return static_cast<Limb>(carry);
+        }
+
+        // a = a / d in place; returns the remainder.
+        static Limb _divideSmall(Limb *a, std::size_t n, Limb d) {
+            DoubleLimb rem = 0;
+            for (std::size_t i = n; i-- > 0;) {
+                DoubleLimb cur = (rem << LIMB_BITS) | a[i];
+                a[i] = static_cast<Limb>(cur / d);
+                rem = cur % d;
+            }
+            return static_cast<Limb>(rem);
+        }
+
+        // Returns a mod d without modifying a.
+        static Limb _remainderSmall(const Limb *a, std::size_t n, Limb d) {
+            DoubleLimb rem = 0;
+            for (std::size_t i = n; i-- > 0;) {
+                rem = ((rem << LIMB_BITS) | a[i]) % d;
+            }
+            return static_cast<Limb>(rem);
+        }
+
+#pragma endregion
+
+        [[nodiscard]] bool _isAbsoluteGreaterOrEqual(const BigInteger &other) const {
+            return _compareLimbs(limbs.data(), limbs.size(), other.limbs.data(), other.limbs.size()) >= 0;
+        }
+
+#pragma region private constructors
+
+        BigInteger() = default;
+
+        // An empty (zero) value whose limbs will be allocated from the given resource.
+        explicit BigInteger(std::pmr::memory_resource *resource) : limbs(resource) {
+        }
+
+        BigInteger(bool isNegative, LimbBuffer limbs)
+            : limbs(std::move(limbs)), isNegative(isNegative) {
+        }
+
+#pragma endregion
+
+#pragma region add&subtract
+
+        // Returns |this| + |other| (non-negative).
+        [[nodiscard]] BigInteger _add(const BigInteger &other) const {
+            const LimbBuffer &a = limbs.size() >= other.limbs.size() ? limbs : other.limbs;
+            const LimbBuffer &b = limbs.size() >= other.limbs.size() ? other.limbs : limbs;
+
+            BigInteger result(limbs.resource());
+            result.limbs.resize(a.size() + 1);
+            result.limbs[a.size()] = _addLimbs(result.limbs.data(), a.data(), a.size(), b.data(), b.size());
+            result.removeLeadingZeros();
+            return result;
+        }
+
+        // Returns |this| - |other| (non-negative), requires |this| >= |other|.
+        [[nodiscard]] BigInteger _subtract(const BigInteger &other) const {
+            BigInteger result(limbs.resource());
+            result.limbs.resize(limbs.size());
+            _subtractLimbs(result.limbs.data(), limbs.data(), limbs.size(), other.limbs.data(), other.limbs.size());
+            result.removeLeadingZeros();
+            return result;
+        }
+
+        // Returns the magnitude of a value with at most two limbs.
+        [[nodiscard]] std::uint64_t _lowWord() const {
+            std::uint64_t word = limbs.size() > 1 ? static_cast<std::uint64_t>(limbs[1]) << LIMB_BITS : 0;
+            return limbs.empty() ? word : word | limbs[0];
+        }
+
+        // Sets the magnitude from a 64-bit word plus an optional carry into a third limb.
+        void _setWord(std::uint64_t word, bool carry) {
+            limbs.resize(carry ? 3 : 2);
+            limbs[0] = static_cast<Limb>(word);
+            limbs[1] = static_cast<Limb>(word >> LIMB_BITS);
+            if (carry) {
+                limbs[2] = 1;
+            }
+            removeLeadingZeros();
+        }
+
+        // Returns a + b, where b is taken with the sign bNegative. Sizes the result buffer once.
+        static BigInteger _sum(const BigInteger &a, const BigInteger &b, bool bNegative) {
+            BigInteger result(a.limbs.resource());
+
+            if (a.limbs.size() <= 2 && b.limbs.size() <= 2) {
+                // Both magnitudes fit into 64 bits: compute on machine words, the result stays inline
+                std::uint64_t x = a._lowWord();
+                std::uint64_t y = b._lowWord();
+                if (a.isNegative == bNegative) {
+                    result._setWord(x + y, x + y < x);
+                    result.isNegative = bNegative && !result.limbs.empty();
+                } else if (x >= y) {
+                    result._setWord(x - y, false);
+                    result.isNegative = a.isNegative && !result.limbs.empty();
+                } else {
+                    result._setWord(y - x, false);
+                    result.isNegative = bNegative;
+                }
+                return result;
+            }
+
+            if (a.isNegative == bNegative) {
+                result = a._add(b);
+                result.isNegative = bNegative; // Result will have the same sign
+            } else if (a._isAbsoluteGreaterOrEqual(b)) {
+                // Determine which number is greater in absolute value
+                result = a._subtract(b);
+                result.isNegative = a.isNegative;
+            } else {
+                result = b._subtract(a);
+                result.isNegative = bNegative;
+            }
+
+            result.removeLeadingZeros(); // Ensure there are no leading zeros and zero is non-negative
+            return result;
+        }
+
+        // *this += other, where other is taken with the sign otherNegative. Works in the existing limb buffer.
+        void _accumulate(const BigInteger &other, bool otherNegative) {
+            if (other.limbs.empty()) {
+                return;
+            }
+
+            if (this == &other) {
+                if (isNegative == otherNegative) {
+                    Limb out = _shiftLeftBits(limbs.data(), limbs.data(), limbs.size(), 1); // x + x = 2x
+                    if (out != 0) {
+                        limbs.push_back(out);
+                    }
+                } else {
+                    limbs.clear(); // x - x = 0
+                    isNegative = false;
+                }
+                return;
+            }
+
+            const std::size_t n = other.limbs.size();
+            if (limbs.empty() || isNegative == otherNegative) {
+                if (limbs.size() < n) {
+                    limbs.resize(n, 0);
+                }
+                Limb carry = _addLimbs(limbs.data(), limbs.data(), limbs.size(), other.limbs.data(), n);
+                if (carry != 0) {
+                    limbs.push_back(carry);
+                }
+                isNegative = otherNegative;
+            } else if (_isAbsoluteGreaterOrEqual(other)) {
+                _subtractLimbs(limbs.data(), limbs.data(), limbs.size(), other.limbs.data(), n);
+                removeLeadingZeros();
+            } else {
+                // |other| > |this|: the difference is computed into the (zero-extended) buffer of this
+                limbs.resize(n, 0);
+                _subtractLimbs(limbs.data(), other.limbs.data(), n, limbs.data(), n);
+                isNegative = otherNegative;
+                removeLeadingZeros();
+            }
+        }
+
+        /*
+         * this += a * b, or this -= a * b when subtract is set. When the shorter factor is below KARATSUBA_THRESHOLD the
+         * schoolbook rows are added to (or subtracted from) the buffer of this instance directly, so no product is
+         * materialized. The buffer has one spare limb, so a result of either sign is exact modulo its size: a set top
+         * bit after subtracting means the product was larger, and negating the buffer yields the magnitude.
+         */
+        void _accumulateProduct(const BigInteger &a, const BigInteger &b, bool subtract) {
+            if (a.limbs.empty() || b.limbs.empty()) {
+                return;
+            }
+            const bool productNegative = (a.isNegative != b.isNegative) != subtract;
+            const LimbBuffer &longer = a.limbs.size() >= b.limbs.size() ? a.limbs : b.limbs;
+            const LimbBuffer &shorter = a.limbs.size() >= b.limbs.size() ? b.limbs : a.limbs;
+            if (shorter.size() >= KARATSUBA_THRESHOLD || this == &a || this == &b) {
+                _accumulate(_product(a, b, 1), productNegative);
+                return;
+            }
+
+            const bool add = limbs.empty() || isNegative == productNegative;
+            if (limbs.empty()) {
+                isNegative = productNegative;
+            }
+            const std::size_t nl = longer.size();
+            const std::size_t size = std::max(limbs.size(), nl + shorter.size()) + 1;
+            limbs.resize(size, 0);
+            Limb *r = limbs.data();
+
+            for (std::size_t i = 0; i < shorter.size(); ++i) {
+                if (add) {
+                    const Limb carry = _addMulLimb(r + i, longer.data(), nl, shorter[i]);
+                    _addInto(r + i + nl, size - i - nl, &carry, 1);
+                } else {
+                    Limb borrow = _subMulLimb(r + i, longer.data(), nl, shorter[i]);
+                    for (std::size_t k = i + nl; borrow != 0 && k < size; ++k) {
+                        const Limb before = r[k];
+                        r[k] = before - borrow;
+                        borrow = before < borrow ? 1 : 0;
+                    }
+                }
+            }
+
+            if (!add && (r[size - 1] >> (LIMB_BITS - 1)) != 0) {
+                // Two's complement negation: invert and add one
+                for (std::size_t k = 0; k < size; ++k) {
+                    r[k] = ~r[k];
+                }
+                const Limb one = 1;
+                _addInto(r, size, &one, 1);
+                isNegative = !isNegative;
+            }
+            removeLeadingZeros();
+            if (limbs.empty()) {
+                isNegative = false;
+            }
+        }
+
+#pragma endregion
+
+#pragma region division helpers
+
+        // r[0..n) = a << bits for 0 <= bits < 32; returns the bits shifted out of the top limb. r may alias a.
+        static Limb _shiftLeftBits(Limb *r, const Limb *a, std::size_t n, int bits) {
+            if (bits == 0) {
+                std::copy_backward(a, a + n, r + n);
+                return 0;
+            }
+            Limb out = n > 0 ? a[n - 1] >> (LIMB_BITS - bits) : 0;
+            for (std::size_t i = n; i-- > 1;) {
+                r[i] = (a[i] << bits) | (a[i - 1] >> (LIMB_BITS - bits));
+            }
+            if (n > 0) {
+                r[0] = a[0] << bits;
+            }
+            return out;
+        }
+
+        // r[0..n) = a >> bits for 0 <= bits < 32. r may alias a.
+        static void _shiftRightBits(Limb *r, const Limb *a, std::size_t n, int bits) {
+            if (bits == 0) {
+                std::copy(a, a + n, r);
+                return;
+            }
+            for (std::size_t i = 0; i + 1 < n; ++i) {
+                r[i] = (a[i] >> bits) | (a[i + 1] << (LIMB_BITS - bits));
+            }
+            if (n > 0) {
+                r[n - 1] = a[n - 1] >> bits;
+            }
+        }
+
+        // Returns x * B^k, where B = 2^32 is the limb base.
+        static BigInteger _shiftedLimbsLeft(const BigInteger &x, std::size_t k) {
+            if (x.limbs.empty()) {
+                return x;
+            }
+            BigInteger result;
+            result.limbs.assign(k + x.limbs.size(), 0);
+            std::copy(x.limbs.begin(), x.limbs.end(), result.limbs.begin() + k);
+            result.isNegative = x.isNegative;
+            return result;
+        }
+
+        // Returns x / B^k truncated toward zero, where B = 2^32 is the limb base.
+        static BigInteger _shiftedLimbsRight(const BigInteger &x, std::size_t k) {
+            BigInteger result;
+            if (k < x.limbs.size()) {
+                result.limbs.assign(x.limbs.begin() + k, x.limbs.end());
+                result.isNegative = x.isNegative;
+            }
+            return result;
+        }
+
+        /*
+         * Knuth's Algorithm D (TAOCP Vol. 2, 4.3.1). u holds the normalized dividend with an extra top limb
+         * (nu limbs), v the divisor with n >= 2 limbs and its top bit set. On return q[0..nu-n) holds the
+         * quotient and u[0..n) the normalized remainder.
+         */
+        static void _divideKnuth(Limb *u, std::size_t nu, const Limb *v, std::size_t n, Limb *q) {
+            constexpr DoubleLimb base = DoubleLimb{1} << LIMB_BITS;
+            const DoubleLimb vTop = v[n - 1];
+            const DoubleLimb vNext = v[n - 2];
+
+            for (std::size_t j = nu - n; j-- > 0;) {
+                // Estimate the quotient limb from the top two limbs and refine it with the third
+                DoubleLimb numerator = (static_cast<DoubleLimb>(u[j + n]) << LIMB_BITS) | u[j + n - 1];
+                DoubleLimb qhat = numerator / vTop;
+                DoubleLimb rhat = numerator % vTop;
+                while (qhat >= base || qhat * vNext > ((rhat << LIMB_BITS) | u[j + n - 2])) {
+                    --qhat;
+                    rhat += vTop;
+                    if (rhat >= base) {
+                        break;
+                    }
+                }
+
+                // Multiply and subtract qhat * v from u[j..j+n]
+                DoubleLimb carry = 0;
+                DoubleLimb borrow = 0;
+                for (std::size_t i = 0; i < n; ++i) {
+                    DoubleLimb product = qhat * v[i] + carry;
+                    carry = product >> LIMB_BITS;
+                    DoubleLimb difference = static_cast<DoubleLimb>(u[i + j]) - static_cast<Limb>(product) - borrow;
+                    u[i + j] = static_cast<Limb>(difference);
+                    borrow = (difference >> LIMB_BITS) & 1;
+                }
+                DoubleLimb difference = static_cast<DoubleLimb>(u[j + n]) - carry - borrow;
+                u[j + n] = static_cast<Limb>(difference);
+
+                // qhat was at most one too large: add v back
+                if ((difference >> LIMB_BITS) != 0) {
+                    --qhat;
+                    u[j + n] += _addLimbs(u + j, u + j, n, v, n);
+                }
+                q[j] = static_cast<Limb>(qhat);
+            }
+        }
+
+        /*
+         * Returns floor(B^(2n) / d) for an n-limb d with its top bit set. Each level halves the precision,
+         * lifts the half-precision reciprocal with one Newton step x += x * (B^(2n) - d * x) / B^(2n) and
+         * fixes the last few units exactly.
+         */
+        static BigInteger _reciprocal(const BigInteger &d) {
+            const std::size_t n = d.limbs.size();
+            BigInteger power;
+            power.limbs.assign(2 * n + 1, 0);
+            power.limbs[2 * n] = 1;
+            if (n < NEWTON_DIVISION_THRESHOLD) {
+                return power / d; // Knuth's algorithm below the threshold
+            }
+
+            const std::size_t low = n / 2;
+            BigInteger x = _shiftedLimbsLeft(_reciprocal(_shiftedLimbsRight(d, low)), low);
+            BigInteger error = power - d * x;
+            x += _shiftedLimbsRight(x * error, 2 * n);
+
+            BigInteger remainder = power - d * x;
+            while (remainder.isNegative) {
+                --x;
+                remainder += d;
+            }
+            while (remainder >= d) {
+                ++x;
+                remainder -= d;
+            }
+            return x;
+        }
+
+        /*
+         * Divides a by an n-limb b with its top bit set using a Newton reciprocal of b. The dividend is consumed in
+         * n-limb blocks, each step dividing a value below b * B^n by multiplying with the reciprocal.
+         */
+        static void _divideNewton(const BigInteger &a, const BigInteger &b, BigInteger &quotient, BigInteger &remainder) {
+            const std::size_t n = b.limbs.size();
+            const std::size_t blocks = (a.limbs.size() + n - 1) / n;
+            const BigInteger x = _reciprocal(b);
+
+            quotient.limbs.assign(blocks * n, 0);
+            quotient.isNegative = false;
+            remainder = BigInteger();
+            for (std::size_t i = blocks; i-- > 0;) {
+                BigInteger current = _shiftedLimbsLeft(remainder, n) + _slice(a.limbs.data(), a.limbs.size(), i * n, (i + 1) * n);
+                BigInteger q = _shiftedLimbsRight(current * x, 2 * n);
+                remainder = current - q * b;
+                while (remainder.isNegative) {
+                    --q;
+                    remainder += b;
+                }
+                while (remainder >= b) {
+                    ++q;
+                    remainder -= b;
+                }
+                std::copy(q.limbs.begin(), q.limbs.end(), quotient.limbs.begin() + i * n);
+            }
+            quotient.removeLeadingZeros();
+        }
+
+        /*
+         * Computes the quotient and remainder of two magnitudes. The divisor must be non-zero. Single-limb divisors
+         * use short division, large balanced operands use Newton reciprocal division and everything else Knuth's
+         * Algorithm D on normalized operands.
+         */
+        static void _divmodMagnitude(const LimbBuffer &a, const LimbBuffer &b,
+                                     LimbBuffer &quotient, LimbBuffer &remainder) {
+            if (_compareLimbs(a.data(), a.size(), b.data(), b.size()) < 0) {
+                quotient.clear();
+                remainder = a;
+                return;
+            }
+
+            if (b.size() == 1) {
+                quotient = a;
+                Limb rem = _divideSmall(quotient.data(), quotient.size(), b[0]);
+                remainder.clear();
+                if (rem != 0) {
+                    remainder.push_back(rem);
+                }
+                return;
+            }
+
+            // Normalize so that the divisor's top bit is set; this does not change the quotient
+            const int shift = std::countl_zero(b.back());
+            const std::size_t na = a.size();
+            const std::size_t nb = b.size();
+            LimbBuffer u(a.resource());
+            LimbBuffer v(a.resource());
+            u.resize(na + 1);
+            v.resize(nb);
+            u[na] = _shiftLeftBits(u.data(), a.data(), na, shift);
+            _shiftLeftBits(v.data(), b.data(), nb, shift);
+
+            if (nb >= NEWTON_DIVISION_THRESHOLD && na - nb >= NEWTON_DIVISION_THRESHOLD) {
+                BigInteger q, r;
+                BigInteger dividend(false, std::move(u));
+                dividend.removeLeadingZeros();
+                _divideNewton(dividend, BigInteger(false, std::move(v)), q, r);
+                quotient = std::move(q.limbs);
+                remainder = std::move(r.limbs);
+                remainder.resize(nb, 0);
+            } else {
+                quotient.assign(na - nb + 1, 0);
+                _divideKnuth(u.data(), na + 1, v.data(), nb, quotient.data());
+                remainder.assign(u.begin(), u.begin() + nb);
+            }
+
+            _shiftRightBits(remainder.data(), remainder.data(), nb, shift);
+            while (!quotient.empty() && quotient.back() == 0) {
+                quotient.pop_back();
+            }
+            while (!remainder.empty() && remainder.back() == 0) {
+                remainder.pop_back();
+            }
+        }
+
+#pragma endregion
+
+#pragma region parallel execution
+
+        // Thread budget for a product of size n: operands below PARALLEL_MULTIPLICATION_THRESHOLD stay serial.
+        static unsigned int _threadsFor(unsigned int threads, std::size_t n) {
+            return n >= PARALLEL_MULTIPLICATION_THRESHOLD ? threads : 1;
+        }
+
+        /*
+         * Runs task(i, budget) for every i in [0, count) on at most `threads` threads and waits for all of them.
+         * Tasks are dealt round-robin into groups that run on their own thread, and each group receives an equal
+         * share of the budget for its own recursion. With a budget of one thread the tasks run inline in order.
+         * Tasks must write to disjoint memory; the caller combines their results serially afterwards.
+         */
+        template<typename Task>
+        static void _forkJoin(std::size_t count, unsigned int threads, const Task &task) {
+            const std::size_t groups = std::min<std::size_t>(threads, count);
+            if (groups <= 1) {
+                for (std::size_t i = 0; i < count; ++i) {
+                    task(i, 1u);
+                }
+                return;
+            }
+
+            const auto share = static_cast<unsigned int>(threads / groups);
+            auto runGroup = [&](std::size_t group) {
+                for (std::size_t i = group; i < count; i += groups) {
+                    task(i, share);
+                }
+            };
+            std::vector<std::future<void>> pending;
+            pending.reserve(groups - 1);
+            for (std::size_t group = 1; group < groups; ++group) {
+                pending.push_back(std::async(std::launch::async, runGroup, group));
+            }
+            runGroup(0);
+            for (std::future<void> &f: pending) {
+                f.get();
+            }
+        }
+
+#pragma endregion
+
+#pragma region number theoretic transform
+
+        // NTT-friendly primes p = c * 2^k + 1, all with primitive root 3. The smallest 2-adic order is 2^23.
+        static constexpr std::uint32_t NTT_PRIME_1 = 998244353; // 119 * 2^23 + 1
+        static constexpr std::uint32_t NTT_PRIME_2 = 167772161; // 5 * 2^25 + 1
+        static constexpr std::uint32_t NTT_PRIME_3 = 469762049; // 7 * 2^26 + 1
+        static constexpr std::uint32_t NTT_ROOT = 3;
+        static constexpr int NTT_PIECE_BITS = 16;
+
+        /*
+         * Limbs are split into 16-bit pieces, so a convolution coefficient is below 2^22 * 2^32 < 2^64 for
+         * transforms up to the 2^23 limit. That is well under p1 * p2 * p3 (about 2^86), which makes the CRT
+         * reconstruction exact, and the reconstructed value fits into 64 bits.
+         */
+        static constexpr std::size_t NTT_MAX_LIMBS = std::size_t{1} << 22;
+
+        static constexpr std::uint32_t _powMod(std::uint64_t base, std::uint64_t exponent, std::uint32_t mod) {
+            std::uint64_t result = 1;
+            base %= mod;
+            while (exponent > 0) {
+                if (exponent & 1) {
+                    result = result * base % mod;
+                }
+                base = base * base % mod;
+                exponent >>= 1;
+            }
+            return static_cast<std::uint32_t>(result);
+        }
+
+        // In-place iterative radix-2 transform of length n (a power of two) modulo Mod.
+        template<std::uint32_t Mod>
+        static void _ntt(std::uint32_t *a, std::size_t n, bool invert) {
+            for (std::size_t i = 1, j = 0; i < n; ++i) {
+                std::size_t bit = n >> 1;
+                for (; j & bit; bit >>= 1) {
+                    j ^= bit;
+                }
+                j ^= bit;
+                if (i < j) {
+                    std::swap(a[i], a[j]);
+                }
+            }
+
+            std::vector<std::uint32_t> roots(n / 2);
+            for (std::size_t length = 2; length <= n; length <<= 1) {
+                const std::size_t half = length / 2;
+                std::uint64_t w = _powMod(NTT_ROOT, (Mod - 1) / length, Mod);
+                if (invert) {
+                    w = _powMod(w, Mod - 2, Mod);
+                }
+                roots[0] = 1;
+                for (std::size_t j = 1; j < half; ++j) {
+                    roots[j] = static_cast<std::uint32_t>(roots[j - 1] * w % Mod);
+                }
+
+                for (std::size_t i = 0; i < n; i += length) {
+                    for (std::size_t j = 0; j < half; ++j) {
+                        std::uint32_t u = a[i + j];
+                        auto v = static_cast<std::uint32_t>(static_cast<std::uint64_t>(a[i + j + half]) * roots[j] % Mod);
+                        a[i + j] = u + v >= Mod ? u + v - Mod : u + v;
+                        a[i + j + half] = u >= v ? u - v : u + Mod - v;
+                    }
+                }
+            }
+
+            if (invert) {
+                const std::uint64_t nInverse = _powMod(n, Mod - 2, Mod);
+                for (std::size_t i = 0; i < n; ++i) {
+                    a[i] = static_cast<std::uint32_t>(a[i] * nInverse % Mod);
+                }
+            }
+        }
+
+        // Cyclic convolution of the pieces modulo Mod; squares pa when pb is null. Both forward transforms run
+        // concurrently when the thread budget allows it.
+        template<std::uint32_t Mod>
+        static std::vector<std::uint32_t> _convolveModulo(const std::vector<std::uint32_t> &pa,
+                                                          const std::vector<std::uint32_t> *pb,
+                                                          unsigned int threads = 1) {
+            const std::size_t n = pa.size();
+            std::vector<std::uint32_t> fa = pa;
+            if (pb == nullptr) {
+                _ntt<Mod>(fa.data(), n, false);
+                for (std::size_t i = 0; i < n; ++i) {
+                    fa[i] = static_cast<std::uint32_t>(static_cast<std::uint64_t>(fa[i]) * fa[i] % Mod);
+                }
+            } else {
+                std::vector<std::uint32_t> fb = *pb;
+                _forkJoin(2, threads, [&](std::size_t i, unsigned int) {
+                    _ntt<Mod>(i == 0 ? fa.data() : fb.data(), n, false);
+                });
+                for (std::size_t i = 0; i < n; ++i) {
+                    fa[i] = static_cast<std::uint32_t>(static_cast<std::uint64_t>(fa[i]) * fb[i] % Mod);
+                }
+            }
+            _ntt<Mod>(fa.data(), n, true);
+            return fa;
+        }
+
+        // Splits limbs into 16-bit pieces, zero-padded to n entries.
+        static std::vector<std::uint32_t> _toPieces(const Limb *a, std::size_t na, std::size_t n) {
+            std::vector<std::uint32_t> pieces(n, 0);
+            for (std::size_t i = 0; i < na; ++i) {
+                pieces[2 * i] = a[i] & 0xFFFF;
+                pieces[2 * i + 1] = a[i] >> NTT_PIECE_BITS;
+            }
+            return pieces;
+        }
+
+        /*
+         * r[0..na+nb) = a * b with three-prime number theoretic transforms and Garner's CRT reconstruction.
+         * All arithmetic is exact integer arithmetic. Requires na + nb <= NTT_MAX_LIMBS. The three transforms are
+         * independent and run in parallel when a thread budget is given.
+         */
+        static void _multiplyNtt(Limb *r, const Limb *a, std::size_t na, const Limb *b, std::size_t nb,
+                                 unsigned int threads = 1) {
+            const bool square = a == b && na == nb;
+            std::size_t n = 1;
+            while (n < 2 * (na + nb)) {
+                n <<= 1;
+            }
+
+            std::vector<std::uint32_t> pa = _toPieces(a, na, n);
+            std::vector<std::uint32_t> pb;
+            if (!square) {
+                pb = _toPieces(b, nb, n);
+            }
+            const std::vector<std::uint32_t> *second = square ? nullptr : &pb;
+            std::vector<std::uint32_t> c1, c2, c3;
+            _forkJoin(3, threads, [&](std::size_t i, unsigned int t) {
+                if (i == 0) {
+                    c1 = _convolveModulo<NTT_PRIME_1>(pa, second, t);
+                } else if (i == 1) {
+                    c2 = _convolveModulo<NTT_PRIME_2>(pa, second, t);
+                } else {
+                    c3 = _convolveModulo<NTT_PRIME_3>(pa, second, t);
+                }
+            });
+
+            constexpr std::uint64_t p1 = NTT_PRIME_1;
+            constexpr std::uint64_t p2 = NTT_PRIME_2;
+            constexpr std::uint64_t p3 = NTT_PRIME_3;
+            constexpr std::uint64_t p1InverseModP2 = _powMod(p1, p2 - 2, p2);
+            constexpr std::uint64_t p1p2InverseModP3 = _powMod(p1 * p2 % p3, p3 - 2, p3);
+            constexpr std::uint64_t p1ModP3 = p1 % p3;
+
+            // Garner reconstruction and carry propagation over 16-bit pieces
+            std::fill(r, r + na + nb, 0);
+            std::uint64_t carry = 0;
+            for (std::size_t i = 0; i < 2 * (na + nb); ++i) {
+                std::uint64_t t1 = c1[i];
+                std::uint64_t t2 = (c2[i] + p2 - t1 % p2) % p2 * p1InverseModP2 % p2;
+                std::uint64_t t3 = (c3[i] + 2 * p3 - t1 % p3 - p1ModP3 * t2 % p3) % p3 * p1p2InverseModP3 % p3;
+                std::uint64_t coefficient = t1 + p1 * t2 + p1 * p2 * t3;
+
+                carry += coefficient & 0xFFFF;
+                std::uint64_t high = coefficient >> NTT_PIECE_BITS;
+                r[i / 2] |= static_cast<Limb>(carry & 0xFFFF) << (NTT_PIECE_BITS * (i % 2));
+                carry = (carry >> NTT_PIECE_BITS) + high;
+            }
+        }
+
+#pragma endregion
+
+#pragma region multiplication helpers
+
+        static std::size_t _trimmedSize(const Limb *a, std::size_t n) {
+            while (n > 0 && a[n - 1] == 0) {
+                --n;
+            }
+            return n;
+        }
+
+        // Builds a non-negative BigInteger from the limbs a[begin..min(end, n)).
+        static BigInteger _slice(const Limb *a, std::size_t n, std::size_t begin, std::size_t end) {
+            BigInteger result;
+            if (begin < n) {
+                result.limbs.assign(a + begin, a + std::min(end, n));
+                result.removeLeadingZeros();
+            }
+            return result;
+        }
+
+        // Divides x by a small divisor that is known to divide it exactly, keeping the sign.
+        static void _divideExact(BigInteger &x, Limb d) {
+            _divideSmall(x.limbs.data(), x.limbs.size(), d);
+            x.removeLeadingZeros();
+        }
+
+        // Signed product x * y on a budget of `threads` threads.
+        static BigInteger _product(const BigInteger &x, const BigInteger &y, unsigned int threads) {
+            if (x.limbs.empty() || y.limbs.empty()) {
+                return zero();
+            }
+
+            BigInteger result(x.limbs.resource());
+            result.limbs.resize(x.limbs.size() + y.limbs.size());
+            if (result.limbs.isInline()) {
+                // Small operands: the product fits the inline buffer, skip the algorithm dispatch
+                _multiplySchoolbook(result.limbs.data(), x.limbs.data(), x.limbs.size(), y.limbs.data(), y.limbs.size());
+            } else {
+                _multiplyLimbs(result.limbs.data(), x.limbs.data(), x.limbs.size(), y.limbs.data(), y.limbs.size(),
+                               threads);
+            }
+
+            result.removeLeadingZeros(); // The top limb may be zero
+            result.isNegative = x.isNegative != y.isNegative; // Determine the sign of the result
+            return result;
+        }
+
+        /*
+         * r[0..na+nb) = a * b. Picks schoolbook, Karatsuba, Toom-3 or NTT depending on the operand sizes and splits
+         * unbalanced operands into balanced pieces. Inputs may carry leading zero limbs. r must not alias a or b.
+         * Independent subproducts fan out over up to `threads` threads once they reach PARALLEL_MULTIPLICATION_THRESHOLD.
+         */
+        static void _multiplyLimbs(Limb *r, const Limb *a, std::size_t na, const Limb *b, std::size_t nb,
+                                   unsigned int threads = 1) {
+            std::size_t total = na + nb;
+            na = _trimmedSize(a, na);
+            nb = _trimmedSize(b, nb);
+            if (na < nb) {
+                std::swap(a, b);
+                std::swap(na, nb);
+            }
+            std::fill(r + na + nb, r + total, 0);
+            threads = _threadsFor(threads, nb);
+
+            if (nb == 0) {
+                std::fill(r, r + na, 0);
+            } else if (a == b && na == nb) {
+                _squareLimbs(r, a, na, threads);
+            } else if (nb >= NTT_THRESHOLD && na + nb <= NTT_MAX_LIMBS) {
+                _multiplyNtt(r, a, na, b, nb, threads);
+            } else if (nb < KARATSUBA_THRESHOLD) {
+                _multiplySchoolbook(r, a, na, b, nb);
+            } else if (na >= 2 * nb && threads > 1) {
+                // The slice products are independent; form them in parallel and accumulate them in order
+                const std::size_t slices = (na + nb - 1) / nb;
+                std::vector<Limb> partials(slices * 2 * nb);
+                _forkJoin(slices, threads, [&](std::size_t i, unsigned int t) {
+                    _multiplyLimbs(partials.data() + i * 2 * nb, a + i * nb, std::min(nb, na - i * nb), b, nb, t);
+                });
+                std::fill(r, r + na + nb, 0);
+                for (std::size_t i = 0; i < slices; ++i) {
+                    const Limb *partial = partials.data() + i * 2 * nb;
+                    _addInto(r + i * nb, na + nb - i * nb, partial, _trimmedSize(partial, std::min(nb, na - i * nb) + nb));
+                }
+            } else if (na >= 2 * nb) {
+                // Multiply nb-sized slices of a by b and accumulate them
+                std::fill(r, r + na + nb, 0);
+                std::vector<Limb> partial(2 * nb);
+                for (std::size_t offset = 0; offset < na; offset += nb) {
+                    std::size_t chunk = std::min(nb, na - offset);
+                    _multiplyLimbs(partial.data(), a + offset, chunk, b, nb);
+                    _addInto(r + offset, na + nb - offset, partial.data(), _trimmedSize(partial.data(), chunk + nb));
+                }
+            } else if (nb < TOOM3_THRESHOLD) {
+                _karatsuba(r, a, na, b, nb, threads);
+            } else {
+                _toom3(r, a, na, b, nb, threads);
+            }
+        }
+
+        // r[0..2n) = a * a with the squaring variants of the multiplication algorithms. r must not alias a.
+        static void _squareLimbs(Limb *r, const Limb *a, std::size_t n, unsigned int threads = 1) {
+            std::size_t total = 2 * n;
+            n = _trimmedSize(a, n);
+            std::fill(r + 2 * n, r + total, 0);
+            threads = _threadsFor(threads, n);
+
+            if (n >= NTT_THRESHOLD && 2 * n <= NTT_MAX_LIMBS) {
+                _multiplyNtt(r, a, n, a, n, threads);
+            } else if (n < KARATSUBA_THRESHOLD) {
+                _squareSchoolbook(r, a, n);
+            } else if (n < TOOM3_THRESHOLD) {
+                _karatsuba(r, a, n, a, n, threads);
+            } else {
+                _toom3(r, a, n, a, n, threads);
+            }
+        }
+
+        // Karatsuba step for na >= nb > na / 2, using three half-sized products. Squares when a and b coincide.
+        static void _karatsuba(Limb *r, const Limb *a, std::size_t na, const Limb *b, std::size_t nb,
+                               unsigned int threads = 1) {
+            const bool square = a == b && na == nb;
+            const std::size_t m = (na + 1) / 2;
+            const std::size_t na1 = na - m;
+            const std::size_t nb1 = nb - m;
+
+            if (nb1 == 0) {
+                // b fits in the low half: r = a0 * b + (a1 * b) << m
+                std::vector<Limb> high(na1 + nb);
+                std::fill(r + m + nb, r + na + nb, 0);
+                _forkJoin(2, threads, [&](std::size_t i, unsigned int t) {
+                    if (i == 0) {
+                        _multiplyLimbs(r, a, m, b, nb, t);
+                    } else {
+                        _multiplyLimbs(high.data(), a + m, na1, b, nb, t);
+                    }
+                });
+                _addInto(r + m, na + nb - m, high.data(), _trimmedSize(high.data(), high.size()));
+                return;
+            }
+
+            // z0 = a0 * b0 goes to r[0..2m), z2 = a1 * b1 goes to r[2m..na+nb)
+            std::vector<Limb> sa(m + 1);
+            std::vector<Limb> z1(2 * m + 2);
+            sa[m] = _addLimbs(sa.data(), a, m, a + m, na1);
+            if (square) {
+                _forkJoin(3, threads, [&](std::size_t i, unsigned int t) {
+                    if (i == 0) {
+                        _squareLimbs(r, a, m, t);
+                    } else if (i == 1) {
+                        _squareLimbs(r + 2 * m, a + m, na1, t);
+                    } else {
+                        _squareLimbs(z1.data(), sa.data(), m + 1, t);
+                    }
+                });
+            } else {
+                std::vector<Limb> sb(m + 1);
+                sb[m] = _addLimbs(sb.data(), b, m, b + m, nb1);
+                _forkJoin(3, threads, [&](std::size_t i, unsigned int t) {
+                    if (i == 0) {
+                        _multiplyLimbs(r, a, m, b, m, t);
+                    } else if (i == 1) {
+                        _multiplyLimbs(r + 2 * m, a + m, na1, b + m, nb1, t);
+                    } else {
+                        _multiplyLimbs(z1.data(), sa.data(), m + 1, sb.data(), m + 1, t);
+                    }
+                });
+            }
+
+            // z1 = (a0 + a1)(b0 + b1) - z0 - z2, added at offset m
+            _subtractLimbs(z1.data(), z1.data(), z1.size(), r, 2 * m);
+            _subtractLimbs(z1.data(), z1.data(), z1.size(), r + 2 * m, na1 + nb1);
+            _addInto(r + m, na + nb - m, z1.data(), _trimmedSize(z1.data(), z1.size()));
+        }
+
+        // Toom-Cook 3-way step evaluating at 0, 1, -1, -2 and infinity with Bodrato's interpolation sequence.
+        static void _toom3(Limb *r, const Limb *a, std::size_t na, const Limb *b, std::size_t nb,
+                           unsigned int threads = 1) {
+            const bool square = a == b && na == nb;
+            const std::size_t k = (na + 2) / 3;
+
+            BigInteger a0 = _slice(a, na, 0, k), a1 = _slice(a, na, k, 2 * k), a2 = _slice(a, na, 2 * k, na);
+            BigInteger t = a0 + a2;
+            BigInteger p1 = t + a1;
+            BigInteger pm1 = t - a1;
+            BigInteger pm2 = pm1 + a2;
+            pm2 = pm2 + pm2 - a0;
+
+            BigInteger b0, b2, q1, qm1, qm2;
+            if (!square) {
+                b0 = _slice(b, nb, 0, k);
+                b2 = _slice(b, nb, 2 * k, nb);
+                BigInteger b1 = _slice(b, nb, k, 2 * k);
+                BigInteger u = b0 + b2;
+                q1 = u + b1;
+                qm1 = u - b1;
+                qm2 = qm1 + b2;
+                qm2 = qm2 + qm2 - b0;
+            }
+
+            // Squaring passes the same object twice, which keeps the squaring path in the pointwise products
+            BigInteger r0, r1, rm1, rm2, rinf;
+            const BigInteger *lhs[] = {&a0, &p1, &pm1, &pm2, &a2};
+            const BigInteger *rhs[] = {&b0, &q1, &qm1, &qm2, &b2};
+            BigInteger *products[] = {&r0, &r1, &rm1, &rm2, &rinf};
+            _forkJoin(5, threads, [&](std::size_t i, unsigned int t) {
+                *products[i] = _product(*lhs[i], square ? *lhs[i] : *rhs[i], t);
+            });
+
+            BigInteger r3 = rm2 - r1;
+            _divideExact(r3, 3);
+            r1 = r1 - rm1;
+            _divideExact(r1, 2);
+            BigInteger r2 = rm1 - r0;
+            r3 = r2 - r3;
+            _divideExact(r3, 2);
+            r3 = r3 + rinf + rinf;
+            r2 = r2 + r1 - rinf;
+            r1 = r1 - r3;
+
+            // All interpolated coefficients are non-negative, so they can be accumulated directly
+            const std::size_t total = na + nb;
+            std::fill(r, r + total, 0);
+            const BigInteger *coefficients[] = {&r0, &r1, &r2, &r3, &rinf};
+            for (std::size_t i = 0; i < 5; ++i) {
+                const LimbBuffer &c = coefficients[i]->limbs;
+                if (!c.empty()) {
+                    _addInto(r + i * k, total - i * k, c.data(), c.size());
+                }
+            }
+        }
+
+#pragma endregion
+
+#pragma region gcd helpers
+
+        // Binary (Stein's) gcd of two machine words.
+        static std::uint64_t _binaryGcd(std::uint64_t u, std::uint64_t v) {
+            if (u == 0 || v == 0) {
+                return u | v;
+            }
+            const int shift = std::countr_zero(u | v);
+            u >>= std::countr_zero(u);
+            do {
+                v >>= std::countr_zero(v);
+                if (u > v) {
+                    std::swap(u, v);
+                }
+                v -= u;
+            } while (v != 0);
+            return u << shift;
+        }
+
+        // Returns the 32 bits of x starting at bit position `shift`; bits past the top read as zero.
+        static Limb _bitsAt(const LimbBuffer &x, std::size_t shift) {
+            const std::size_t index = shift / LIMB_BITS;
+            DoubleLimb word = index < x.size() ? x[index] : 0;
+            if (index + 1 < x.size()) {
+                word |= static_cast<DoubleLimb>(x[index + 1]) << LIMB_BITS;
+            }
+            return static_cast<Limb>(word >> (shift % LIMB_BITS));
+        }
+
+        // r[0..n) = x * p - y * q with both operands read as zero-padded; the result must be non-negative and fit into
+        // n limbs. Each limb of x and y is read before r at the same index is written, so r may alias either.
+        static void _linearCombination(Limb *r, const LimbBuffer &x, Limb p, const LimbBuffer &y, Limb q,
+                                       std::size_t n) {
+            DoubleLimb carryX = 0;
+            DoubleLimb carryY = 0;
+            Limb borrow = 0;
+            for (std::size_t i = 0; i < n; ++i) {
+                DoubleLimb px = static_cast<DoubleLimb>(i < x.size() ? x[i] : 0) * p + carryX;
+                DoubleLimb qy = static_cast<DoubleLimb>(i < y.size() ? y[i] : 0) * q + carryY;
+                carryX = px >> LIMB_BITS;
+                carryY = qy >> LIMB_BITS;
+                DoubleLimb diff = static_cast<DoubleLimb>(static_cast<Limb>(px)) - static_cast<Limb>(qy) - borrow;
+                r[i] = static_cast<Limb>(diff);
+                borrow = static_cast<Limb>(diff >> LIMB_BITS) & 1;
+            }
+        }
+
+        // r = s * x + t * y for single-word cofactors of opposite signs (as produced by a Lehmer step).
+        static void _applyCofactors(LimbBuffer &r, const LimbBuffer &x, std::int64_t s,
+                                    const LimbBuffer &y, std::int64_t t, std::size_t n) {
+            r.resize(n);
+            if (t <= 0) {
+                _linearCombination(r.data(), x, static_cast<Limb>(s), y, static_cast<Limb>(-t), n);
+            } else {
+                _linearCombination(r.data(), y, static_cast<Limb>(t), x, static_cast<Limb>(-s), n);
+            }
+            r.resize(_trimmedSize(r.data(), n));
+        }
+
+        /*
+         * Lehmer's gcd of two magnitudes with u >= v. Each round simulates the Euclidean steps determined by the leading
+         * 32 bits of both operands with single-word cofactors (Knuth's Algorithm L) and applies them in one linear pass;
+         * when the leading digits do not decide a quotient a full division step is taken instead.
+         *
+         * When su and sv are given they carry the coefficients of the original first operand for u and v (u = su * a
+         * + ... and v = sv * a + ...) and the loop runs down to zero. Otherwise, once u fits into 64 bits the remaining
+         * steps are left to the binary algorithm.
+         */
+        static LimbBuffer _gcdMagnitude(LimbBuffer u, LimbBuffer v, BigInteger *su, BigInteger *sv) {
+            LimbBuffer nextU;
+            LimbBuffer nextV;
+            LimbBuffer quotient;
+            LimbBuffer remainder;
+
+            while (!v.empty()) {
+                if (su == nullptr && u.size() <= 2) {
+                    auto word = [](const LimbBuffer &x) {
+                        return (x.size() > 1 ? static_cast<std::uint64_t>(x[1]) << LIMB_BITS : 0) | x[0];
+                    };
+                    std::uint64_t g = _binaryGcd(word(u), word(v));
+                    LimbBuffer result{static_cast<Limb>(g), static_cast<Limb>(g >> LIMB_BITS)};
+                    result.resize(_trimmedSize(result.data(), 2));
+                    return result;
+                }
+
+                const std::size_t bits = u.size() * LIMB_BITS - std::countl_zero(u.back());
+                const std::size_t shift = bits > LIMB_BITS ? bits - LIMB_BITS : 0;
+                std::int64_t x = _bitsAt(u, shift);
+                std::int64_t y = _bitsAt(v, shift);
+                std::int64_t a = 1, b = 0, c = 0, d = 1;
+                while (y + c != 0 && y + d != 0) {
+                    std::int64_t q = (x + a) / (y + c);
+                    if (q != (x + b) / (y + d)) {
+                        break;
+                    }
+                    std::int64_t t = a - q * c;
+                    a = c;
+                    c = t;
+                    t = b - q * d;
+                    b = d;
+                    d = t;
+                    t = x - q * y;
+                    x = y;
+                    y = t;
+                }
+
+                if (b == 0) {
+                    _divmodMagnitude(u, v, quotient, remainder);
+                    if (su != nullptr) {
+                        BigInteger next = *su - BigInteger(false, quotient) * *sv;
+                        *su = std::move(*sv);
+                        *sv = std::move(next);
+                    }
+                    std::swap(u, v);
+                    std::swap(v, remainder);
+                } else {
+                    _applyCofactors(nextU, u, a, v, b, u.size());
+                    _applyCofactors(nextV, u, c, v, d, u.size());
+                    if (su != nullptr) {
+                        BigInteger next = from_integer(c) * *su + from_integer(d) * *sv;
+                        *su = from_integer(a) * *su + from_integer(b) * *sv;
+                        *sv = std::move(next);
+                    }
+                    std::swap(u, nextU);
+                    std::swap(v, nextV);
+                }
+            }
+            return u;
+        }
+
+#pragma endregion
+
+#pragma region radix conversion helpers
+
+        // A divisor prepared for repeated division of values below its square: shifted left so that its top bit is
+        // set and paired with the reciprocal floor(B^(2n) / normalized) of its n limbs.
+        struct PreparedDivisor {
+            int shift = 0;
+            LimbBuffer normalized;
+            LimbBuffer reciprocal;
+        };
+
+        static PreparedDivisor _prepareDivisor(const BigInteger &d) {
+            PreparedDivisor prepared;
+            prepared.shift = std::countl_zero(d.limbs.back());
+            prepared.normalized.resize(d.limbs.size());
+            _shiftLeftBits(prepared.normalized.data(), d.limbs.data(), d.limbs.size(), prepared.shift);
+            prepared.reciprocal = _reciprocal(BigInteger(false, prepared.normalized)).limbs;
+            return prepared;
+        }
+
+        // A cached power 10^(9 * c) (first) with its prepared divisor (second), which stays empty below
+        // RADIX_RECIPROCAL_THRESHOLD limbs.
+        using DecimalPower = std::pair<BigInteger, PreparedDivisor>;
+
+        // Smallest chunk count of the form 2^j or 3 * 2^j that is at least c. Halving such a count stays on the ladder.
+        static std::size_t _decimalLadder(std::size_t c) {
+            std::size_t power = 1;
+            while (power < c) {
+                if (power >= 2 && power / 2 * 3 >= c) {
+                    return power / 2 * 3;
+                }
+                power *= 2;
+            }
+            return power;
+        }
+
+        /*
+         * Returns the process-wide cached power 10^(9 * c) for a ladder count c, computing it on first use as the square
+         * of the entry for c / 2, and its reciprocal when `prepared` is set and the power is large enough. The cache
+         * only holds ladder counts, so it stays within a small multiple of the largest value converted so far. Entries
+         * are never removed and std::map nodes do not move, so the returned reference stays valid.
+         *
+         * The mutex only guards the map itself: a missing power is computed without holding it and then published, the
+         * first publisher winning if two threads raced on the same count, so conversions of unrelated sizes never wait
+         * for each other. The reciprocal is computed under the entry's once_flag, which blocks only the threads that
+         * need that same reciprocal. Only `prepared` callers read it, always after passing the once_flag.
+         */
+        static const DecimalPower &_decimalPower(std::size_t c, bool prepared) {
+            // The prepared divisor of an entry is filled in at most once, on first request
+            struct DecimalCacheEntry {
+                explicit DecimalCacheEntry(BigInteger power) : value(std::move(power), PreparedDivisor()) {
+                }
+
+                DecimalPower value;
+                std::once_flag preparedOnce;
+            };
+
+            static std::mutex mutex;
+            static std::map<std::size_t, DecimalCacheEntry> cache;
+
+            DecimalCacheEntry *entry = nullptr;
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                auto found = cache.find(c);
+                if (found != cache.end()) {
+                    entry = &found->second;
+                }
+            }
+            if (entry == nullptr) {
+                BigInteger power = from_integer(DECIMAL_CHUNK);
+                if (c == 3) {
+                    power = power * power * power;
+                } else if (c > 1) {
+                    const BigInteger &half = _decimalPower(c / 2, false).first;
+                    power = half * half;
+                }
+                std::lock_guard<std::mutex> lock(mutex);
+                entry = &cache.try_emplace(c, std::move(power)).first->second;
+            }
+
+            if (prepared && entry->value.first.limbs.size() >= RADIX_RECIPROCAL_THRESHOLD) {
+                std::call_once(entry->preparedOnce, [entry] {
+                    entry->value.second = _prepareDivisor(entry->value.first);
+                });
+            }
+            return entry->value;
+        }
+
+        /*
+         * Chunk counts c_0 >= ceil(chunks / 2), c_(k+1) = c_k / 2, ..., 1 taken from the ladder of _decimalLadder, with
+         * powers[k] pointing at the cached 10^(9 * c_k). Splitting by these powers keeps both halves within a factor of
+         * three of each other at every level of the radix conversion.
+         */
+        static void _decimalSplits(std::size_t chunks, std::vector<std::size_t> &counts,
+                                   std::vector<const DecimalPower *> &powers, bool prepared) {
+            for (std::size_t c = _decimalLadder((chunks + 1) / 2);; c = (c + 1) / 2) {
+                counts.push_back(c);
+                powers.push_back(&_decimalPower(c, prepared));
+                if (c <= 1) {
+                    break;
+                }
+            }
+        }
+
+        // 10^exponent, assembled from the cached powers 10^(9 * 2^j) and one small power of ten.
+        static BigInteger _powerOfTen(std::size_t exponent) {
+            BigInteger result = from_integer(1);
+            Limb small = 1;
+            for (std::size_t i = 0; i < exponent % DECIMAL_CHUNK_DIGITS; ++i) {
+                small *= 10;
+            }
+            result.limbs[0] = small;
+            std::size_t chunks = exponent / DECIMAL_CHUNK_DIGITS;
+            for (std::size_t c = 1; chunks != 0; c *= 2, chunks >>= 1) {
+                if (chunks & 1) {
+                    result *= _decimalPower(c, false).first;
+                }
+            }
+            return result;
+        }
+
+        // Appends the decimal digits of a[0..n) by peeling off chunks of 9 digits, left-padded with zeros to `width`.
+        static void _appendDecimalChunks(std::string &out, const Limb *a, std::size_t n, std::size_t width) {
+            std::vector<Limb> magnitude(a, a + _trimmedSize(a, n));
+            std::vector<Limb> chunks;
+            chunks.reserve(magnitude.size() * 10 / 9 + 1);
+            while (!magnitude.empty()) {
+                chunks.push_back(_divideSmall(magnitude.data(), magnitude.size(), DECIMAL_CHUNK));
+                while (!magnitude.empty() && magnitude.back() == 0) {
+                    magnitude.pop_back();
+                }
+            }
+
+            std::string head = chunks.empty() ? std::string() : std::to_string(chunks.back());
+            std::size_t digits = chunks.empty() ? 0 : head.size() + (chunks.size() - 1) * DECIMAL_CHUNK_DIGITS;
+            if (width > digits) {
+                out.append(width - digits, '0');
+            }
+            out += head;
+            for (std::size_t i = chunks.size() - (chunks.empty() ? 0 : 1); i-- > 0;) {
+                char buffer[DECIMAL_CHUNK_DIGITS];
+                Limb value = chunks[i];
+                for (int j = DECIMAL_CHUNK_DIGITS - 1; j >= 0; --j) {
+                    buffer[j] = static_cast<char>('0' + value % 10);
+                    value /= 10;
+                }
+                out.append(buffer, DECIMAL_CHUNK_DIGITS);
+            }
+        }
+
+        // Splits x < d^2 into quotient and remainder by d with Barrett's method, multiplying by the prepared reciprocal.
+        static void _divmodPrepared(const BigInteger &x, const PreparedDivisor &d, BigInteger &quotient,
+                                    BigInteger &remainder) {
+            const std::size_t n = d.normalized.size();
+            const BigInteger divisor(false, d.normalized);
+            BigInteger current;
+            current.limbs.resize(x.limbs.size() + 1);
+            current.limbs[x.limbs.size()] = _shiftLeftBits(current.limbs.data(), x.limbs.data(), x.limbs.size(), d.shift);
+            current.removeLeadingZeros();
+
+            // Only the top n + 1 limbs of the dividend matter for the estimate, which is then off by at most two
+            quotient = _shiftedLimbsRight(_shiftedLimbsRight(current, n - 1) * BigInteger(false, d.reciprocal), n + 1);
+            remainder = current - quotient * divisor;
+            while (remainder.isNegative) {
+                --quotient;
+                remainder += divisor;
+            }
+            while (remainder >= divisor) {
+                ++quotient;
+                remainder -= divisor;
+            }
+            _shiftRightBits(remainder.limbs.data(), remainder.limbs.data(), remainder.limbs.size(), d.shift);
+            remainder.removeLeadingZeros();
+        }
+
+        /*
+         * Appends the decimal digits of the magnitude x < powers[level]^2, zero-padded to `width` digits (0 for no
+         * padding). Large values are split by powers[level] into a high and a low half which are converted recursively,
+         * the low half padded to the full 9 * counts[level] digits. Levels whose power reaches
+         * RADIX_RECIPROCAL_THRESHOLD limbs divide by multiplying with the cached reciprocal of the power.
+         */
+        static void _appendDecimal(std::string &out, const BigInteger &x, const std::vector<std::size_t> &counts,
+                                   const std::vector<const DecimalPower *> &powers, std::size_t level, std::size_t width) {
+            if (level == counts.size() || x.limbs.size() < RADIX_CONVERSION_THRESHOLD) {
+                _appendDecimalChunks(out, x.limbs.data(), x.limbs.size(), width);
+                return;
+            }
+
+            BigInteger high;
+            BigInteger low;
+            if (!powers[level]->second.reciprocal.empty()) {
+                _divmodPrepared(x, powers[level]->second, high, low);
+            } else {
+                _divmodMagnitude(x.limbs, powers[level]->first.limbs, high.limbs, low.limbs);
+            }
+
+            const std::size_t lowWidth = counts[level] * DECIMAL_CHUNK_DIGITS;
+            if (width == 0 && high.limbs.empty()) {
+                _appendDecimal(out, low, counts, powers, level + 1, 0);
+            } else {
+                _appendDecimal(out, high, counts, powers, level + 1, width == 0 ? 0 : width - lowWidth);
+                _appendDecimal(out, low, counts, powers, level + 1, lowWidth);
+            }
+        }
+
+        // Converts chunks of 9 digits at a time, the first chunk taking the remainder.
+        static BigInteger _parseDecimalChunks(const char *digits, std::size_t length) {
+            BigInteger result;
+            std::size_t chunk = length % DECIMAL_CHUNK_DIGITS == 0 ? DECIMAL_CHUNK_DIGITS : length % DECIMAL_CHUNK_DIGITS;
+            result.limbs.reserve(length / DECIMAL_CHUNK_DIGITS + 1); // 9 decimal digits always fit in one limb
+            for (std::size_t i = 0; i < length; i += chunk, chunk = DECIMAL_CHUNK_DIGITS) {
+                Limb value = 0;
+                Limb scale = 1;
+                for (std::size_t j = i; j < i + chunk; ++j) {
+                    value = value * 10 + static_cast<Limb>(digits[j] - '0');
+                    scale *= 10;
+                }
+                Limb carry = _multiplyAddSmall(result.limbs.data(), result.limbs.size(), scale, value);
+                if (carry != 0) {
+                    result.limbs.push_back(carry);
+                }
+            }
+            result.removeLeadingZeros();
+            return result;
+        }
+
+        // Parses a validated digit string: the trailing 9 * counts[level] digits and the head are converted recursively
+        // and joined by one multiplication with the cached powers[level].
+        static BigInteger _parseDecimal(const char *digits, std::size_t length, const std::vector<std::size_t> &counts,
+                                        const std::vector<const DecimalPower *> &powers, std::size_t level) {
+            if (level == counts.size() || length < RADIX_CONVERSION_THRESHOLD * DECIMAL_CHUNK_DIGITS) {
+                return _parseDecimalChunks(digits, length);
+            }
+
+            const std::size_t lowLength = counts[level] * DECIMAL_CHUNK_DIGITS;
+            if (lowLength >= length) {
+                return _parseDecimal(digits, length, counts, powers, level + 1);
+            }
+            BigInteger result = _parseDecimal(digits, length - lowLength, counts, powers, level + 1) * powers[level]->first;
+            result += _parseDecimal(digits + (length - lowLength), lowLength, counts, powers, level + 1);
+            return result;
+        }
+
+#pragma endregion
+
+#pragma region bitwise helpers
+
+        /*
+         * this = this op other on the infinite two's complement representations. Both operands are converted limb by
+         * limb on the fly (~magnitude + 1 for negative values), combined, and a negative result is converted back the
+         * same way, so the whole operation is a single pass. `other` may be this instance.
+         */
+        template<typename Op>
+        void _applyBitwise(const BigInteger &other, Op op) {
+            const Limb extendThis = isNegative ? ~Limb{0} : 0;
+            const Limb extendOther = other.isNegative ? ~Limb{0} : 0;
+            const bool negative = op(extendThis, extendOther) != 0;
+            const bool otherNegative = other.isNegative;
+            const std::size_t otherSize = other.limbs.size();
+            const std::size_t n = std::max(limbs.size(), otherSize) + 1;
+            limbs.resize(n);
+
+            Limb carryThis = 1;
+            Limb carryOther = 1;
+            Limb carryResult = 1;
+            for (std::size_t i = 0; i < n; ++i) {
+                Limb a = limbs[i];
+                Limb b = i < otherSize ? other.limbs[i] : 0;
+                if (isNegative) {
+                    Limb inverted = ~a;
+                    a = inverted + carryThis;
+                    carryThis &= a == 0 ? 1 : 0;
+                }
+                if (otherNegative) {
+                    Limb inverted = ~b;
+                    b = inverted + carryOther;
+                    carryOther &= b == 0 ? 1 : 0;
+                }
+                Limb r = op(a, b);
+                if (negative) {
+                    Limb inverted = ~r;
+                    r = inverted + carryResult;
+                    carryResult &= r == 0 ? 1 : 0;
+                }
+                limbs[i] = r;
+            }
+
+            isNegative = negative;
+            removeLeadingZeros();
+        }
+
+#pragma endregion
+
+#pragma region root helpers
+
+        // Returns the low `bits` bits of the magnitude of x.
+        static BigInteger _lowBits(const BigInteger &x, std::size_t bits) {
+            const std::size_t whole = bits / LIMB_BITS;
+            const int rest = static_cast<int>(bits % LIMB_BITS);
+            const std::size_t n = std::min(x.limbs.size(), whole + (rest != 0 ? 1 : 0));
+            BigInteger result;
+            result.limbs.assign(x.limbs.begin(), x.limbs.begin() + n);
+            if (rest != 0 && n == whole + 1) {
+                result.limbs[whole] &= (Limb{1} << rest) - 1;
+            }
+            result.removeLeadingZeros();
+            return result;
+        }
+
+        /*
+         * Zimmermann's Karatsuba square root: s = floor(sqrt(x)) and r = x - s^2 for 2^(2n-2) <= x < 2^(2n). The high
+         * 2h bits are rooted recursively, and the next l = floor(n / 2) bits of the root come from one division by
+         * twice the partial root, so the cost is dominated by the division and squaring at the top level.
+         */
+        static void _sqrtRem(const BigInteger &x, std::size_t n, BigInteger &s, BigInteger &r) {
+            if (n <= 32) {
+                const std::uint64_t value = *x.to<std::uint64_t>();
+                auto root = static_cast<std::uint64_t>(std::sqrt(static_cast<double>(value)));
+                while (root > 0 && root > value / root) {
+                    --root;
+                }
+                while (root + 1 <= value / (root + 1)) {
+                    ++root;
+                }
+                s = from_integer(root);
+                r = from_integer(value - root * root);
+                return;
             }
-            if (digits.size() == 1 && digits[0] == 0) {
-                isNegative = false; // Ensure 0 is always positive
+
+            const std::size_t l = n / 2;
+            const std::size_t h = n - l;
+            BigInteger highRoot;
+            BigInteger highRemainder;
+            _sqrtRem(x >> (2 * l), h, highRoot, highRemainder);
+
+            auto [q, u] = ((highRemainder << l) + _lowBits(x >> l, l)).divmod(highRoot << 1);
+            s = (highRoot << l) + q;
+            r = (u << l) + _lowBits(x, l) - q * q;
+            while (r.isNegative) {
+                // (s - 1)^2 = s^2 - 2s + 1
+                r += (s << 1) - one();
+                --s;
             }
         }
 
-        [[nodiscard]] bool _isAbsoluteGreaterOrEqual(const BigInteger &other) const {
-            if (digits.size() != other.digits.size()) {
-                return digits.size() > other.digits.size();
+        // base^exponent mod modulus for a modulus below 2^32
+        static std::uint64_t _powModSmall(std::uint64_t base, std::uint64_t exponent, std::uint64_t modulus) {
+            std::uint64_t result = 1 % modulus;
+            base %= modulus;
+            for (; exponent > 0; exponent >>= 1) {
+                if ((exponent & 1) != 0) {
+                    result = result * base % modulus;
+                }
+                base = base * base % modulus;
             }
+            return result;
+        }
 
-            for (int i = static_cast<int>(digits.size()) - 1; i >= 0; --i) {
-                if (digits[i] != other.digits[i]) {
-                    return digits[i] > other.digits[i];
+        // Trial division primality test for the small moduli p = 1 (mod k) used by is_perfect_power.
+        static bool _isSmallPrime(std::uint64_t n) {
+            if (n < 2) {
+                return false;
+            }
+            for (std::uint64_t d = 2; d * d <= n; ++d) {
+                if (n % d == 0) {
+                    return false;
                 }
             }
-
-            return true; // Equal in absolute value
+            return true;
         }
 
-#pragma region private constructors
+#pragma endregion
 
-        BigInteger() = default;
+#pragma region factorial helpers
 
-        BigInteger(bool isNegative, const std::vector<std::uint8_t> &digits)
-            : digits(digits), isNegative(isNegative) {
+        // The primes up to n. SieveOfEratosthenes works in int and steps past its bound by up to sqrt(n), so bounds
+        // beyond half the int range are rejected with std::length_error instead of being truncated.
+        static std::vector<int> _primesUpTo(std::size_t n) {
+            if (n > static_cast<std::size_t>(std::numeric_limits<int>::max() / 2)) {
+                throw std::length_error("Prime sieve bound is too large.");
+            }
+            return SieveOfEratosthenes(static_cast<int>(n));
         }
 
-#pragma endregion
-
-#pragma region add&subtract
-
-        [[nodiscard]] BigInteger _add(const BigInteger &other) const {
-            BigInteger result;
-            result.digits.clear(); // Ensure the result starts with an empty digit vector
+        // Multiplies f into the last word of `words`, starting a new word when the product would overflow 64 bits.
+        static void _appendFactor(std::vector<std::uint64_t> &words, std::uint64_t f) {
+            if (words.empty() || words.back() > std::numeric_limits<std::uint64_t>::max() / f) {
+                words.push_back(f);
+            } else {
+                words.back() *= f;
+            }
+        }
 
-            size_t maxLength = std::max(digits.size(), other.digits.size());
-            int carry = 0;
+        // Product of words[lo, hi), split in halves so that every multiplication sees operands of similar size.
+        static BigInteger _productTree(const std::vector<std::uint64_t> &words, std::size_t lo, std::size_t hi) {
+            if (hi - lo == 0) {
+                return one();
+            }
+            if (hi - lo == 1) {
+                return from_integer(words[lo]);
+            }
+            if (hi - lo == 2) {
+                return from_integer(words[lo]) * from_integer(words[lo + 1]);
+            }
+            const std::size_t mid = lo + (hi - lo) / 2;
+            return _productTree(words, lo, mid) * _productTree(words, mid, hi);
+        }
 
-            for (size_t i = 0; i < maxLength || carry; ++i) {
-                int digitSum = carry;
+        /*
+         * Odd part of n!, by Schoenhage's prime swing: n! = ((n/2)!)^2 * swing(n) with swing(n) = n! / ((n/2)!)^2,
+         * and the exponent of an odd prime p in swing(n) is the number of odd quotients floor(n / p^i). `primes` holds
+         * the odd primes up to the top-level n; each level only reads the prefix it needs.
+         */
+        static BigInteger _oddFactorial(unsigned int n, const std::vector<int> &primes) {
+            if (n < 21) {
+                std::uint64_t value = 1;
+                for (unsigned int i = 2; i <= n; ++i) {
+                    value *= i;
+                }
+                return from_integer(value >> std::countr_zero(value));
+            }
 
-                if (i < digits.size()) {
-                    digitSum += digits[i];
+            BigInteger half = _oddFactorial(n / 2, primes);
+            std::vector<std::uint64_t> words;
+            for (int p: primes) {
+                if (static_cast<unsigned int>(p) > n) {
+                    break;
                 }
-                if (i < other.digits.size()) {
-                    digitSum += other.digits[i];
+                for (unsigned int q = n / static_cast<unsigned int>(p); q > 0; q /= static_cast<unsigned int>(p)) {
+                    if (q & 1) {
+                        _appendFactor(words, static_cast<std::uint64_t>(p));
+                    }
                 }
-
-                result.digits.push_back(digitSum % 10); // Store the single digit
-                carry = digitSum / 10; // Calculate carry for the next digit
             }
-
-            return result;
+            return half * half * _productTree(words, 0, words.size());
         }
 
-        [[nodiscard]] BigInteger _subtract(const BigInteger &other) const {
-            BigInteger result;
-            result.digits.clear();
+#pragma endregion
 
-            int borrow = 0;
-            for (size_t i = 0; i < digits.size(); ++i) {
-                int digitSub = digits[i] - borrow - (i < other.digits.size() ? other.digits[i] : 0);
-                borrow = 0;
+#pragma region serialization helpers
 
-                if (digitSub < 0) {
-                    digitSub += 10;
-                    borrow = 1;
+        // Writes n limbs as 4n little-endian bytes.
+        static void _storeLimbs(std::byte *out, const Limb *limbs, std::size_t n) {
+            if (n == 0) {
+                return; // Zero has no limbs, and memcpy must not see the null data() of an empty buffer
+            }
+            if constexpr (std::endian::native == std::endian::little) {
+                std::memcpy(out, limbs, n * sizeof(Limb));
+            } else {
+                for (std::size_t i = 0; i < n; ++i) {
+                    for (std::size_t k = 0; k < sizeof(Limb); ++k) {
+                        out[i * sizeof(Limb) + k] = static_cast<std::byte>(limbs[i] >> (8 * k));
+                    }
                 }
+            }
+        }
 
-                result.digits.push_back(digitSub);
+        // Reads `count` little-endian bytes into limbs; the limb buffer must already be zeroed and large enough.
+        static void _loadLimbs(Limb *limbs, const std::byte *in, std::size_t count) {
+            if (count == 0) {
+                return;
+            }
+            if constexpr (std::endian::native == std::endian::little) {
+                std::memcpy(limbs, in, count);
+            } else {
+                for (std::size_t i = 0; i < count; ++i) {
+                    limbs[i / sizeof(Limb)] |= static_cast<Limb>(in[i]) << (8 * (i % sizeof(Limb)));
+                }
             }
+        }
 
-            result.removeLeadingZeros(); // Defined previously to remove leading zeros
+        // Appends value as an unsigned LEB128 varint: 7 bits per byte, low groups first, high bit marks continuation.
+        static void _writeVarint(std::vector<std::byte> &out, std::uint64_t value) {
+            while (value >= 0x80) {
+                out.push_back(static_cast<std::byte>((value & 0x7F) | 0x80));
+                value >>= 7;
+            }
+            out.push_back(static_cast<std::byte>(value));
+        }
 
-            return result;
+        // Reads an unsigned LEB128 varint at data[pos], advancing pos. Throws on truncated or over-long input.
+        static std::uint64_t _readVarint(std::span<const std::byte> data, std::size_t &pos) {
+            std::uint64_t value = 0;
+            for (int shift = 0; shift < 64; shift += 7) {
+                if (pos >= data.size()) {
+                    throw std::invalid_argument("Truncated BigInteger header.");
+                }
+                const auto byte = static_cast<std::uint64_t>(data[pos++]);
+                if (shift == 63 && byte > 1) {
+                    break;
+                }
+                value |= (byte & 0x7F) << shift;
+                if ((byte & 0x80) == 0) {
+                    return value;
+                }
+            }
+            throw std::invalid_argument("Malformed BigInteger header.");
         }
 
 #pragma endregion
 
     public:
+#pragma region tuning
+
+        /**
+         * Operand size (in 32-bit limbs) from which multiplication and squaring switch from the schoolbook
+         * algorithm to Karatsuba. Tuned for 32-bit limbs with 64-bit intermediate products.
+         */
+        static constexpr std::size_t KARATSUBA_THRESHOLD = 40;
+
+        /**
+         * Operand size (in 32-bit limbs) from which multiplication and squaring switch from Karatsuba to
+         * Toom-Cook 3-way. Must be larger than KARATSUBA_THRESHOLD.
+         */
+        static constexpr std::size_t TOOM3_THRESHOLD = 300;
+
+        /**
+         * Operand size (in 32-bit limbs) from which multiplication and squaring switch to the exact three-prime
+         * number theoretic transform. Products larger than the transform limit (2^22 limbs) are split by Toom-3
+         * until the pieces fit.
+         */
+        static constexpr std::size_t NTT_THRESHOLD = 4000;
+
+        /**
+         * Divisor and quotient size (in 32-bit limbs) from which division switches from Knuth's Algorithm D to
+         * Newton reciprocal division, which inherits the subquadratic multiplication.
+         */
+        static constexpr std::size_t NEWTON_DIVISION_THRESHOLD = 8000;
+
+        /**
+         * Operand size (in 32-bit limbs) from which `to_string` and `parse` switch from converting 9 digits at a time
+         * to divide-and-conquer conversion over powers 10^(9 * c) shared process-wide through a lazily grown cache.
+         */
+        static constexpr std::size_t RADIX_CONVERSION_THRESHOLD = 60;
+
+        /**
+         * Size (in 32-bit limbs) of the power of ten from which `to_string` divides by multiplying with a reciprocal,
+         * cached next to the power, instead of running a long division at every split.
+         */
+        static constexpr std::size_t RADIX_RECIPROCAL_THRESHOLD = 400;
+
+        /**
+         * Exponent from which `multiplyByPowerOfTen` and `divideByPowerOfTen` use a single multiplication or division
+         * by the cached power of ten instead of scaling by 10^9 once per nine digits.
+         */
+        static constexpr std::size_t POWER_OF_TEN_THRESHOLD = KARATSUBA_THRESHOLD * DECIMAL_CHUNK_DIGITS;
+
+        /**
+         * Root size (in bits) below which `is_perfect_power` tests an exponent by rounding the floating-point root
+         * instead of computing it exactly. The rounded estimate is off by far less than one up to this size.
+         */
+        static constexpr int PERFECT_POWER_SMALL_ROOT_BITS = 40;
+
+        /**
+         * Smaller operand size (in 32-bit limbs) from which `multiply` hands subproducts to other threads. Below it the
+         * cost of starting a thread outweighs the work it would take over.
+         */
+        static constexpr std::size_t PARALLEL_MULTIPLICATION_THRESHOLD = 2000;
+
+#pragma endregion
+
 #pragma region conversion
 
         /**
          * Constructs a BigInteger from a string representation.
          * @param number A string representing a potentially large integer.
+         * @param resource The memory resource for the limbs of the result, or nullptr for the global operator new.
          * @return A BigInteger instance corresponding to the input string.
          * @throws std::invalid_argument If the string contains non-numeric characters (excluding an initial minus sign).
          */
-        static BigInteger parse(const std::string &number) {
-            BigInteger result;
+        static BigInteger parse(const std::string &number, std::pmr::memory_resource *resource = nullptr) {
+            BigInteger result(resource);
             size_t start = 0;
 
             if (!number.empty() && number[0] == '-') {
-                result.isNegative = true;
                 start = 1;
             }
 
-            for (size_t i = number.size(); i > start; --i) {
-                char c = number[i - 1];
+            for (size_t i = start; i < number.size(); ++i) {
+                char c = number[i];
                 if (c < '0' || c > '9') {
                     throw std::invalid_argument("Invalid character in number string.");
                 }
-                result.digits.push_back(c - '0');
             }
+
+            std::size_t length = number.size() - start;
+            if (length < RADIX_CONVERSION_THRESHOLD * DECIMAL_CHUNK_DIGITS) {
+                result = _parseDecimalChunks(number.data() + start, length);
+            } else {
+                std::vector<std::size_t> counts;
+                std::vector<const DecimalPower *> powers;
+                _decimalSplits((length + DECIMAL_CHUNK_DIGITS - 1) / DECIMAL_CHUNK_DIGITS, counts, powers, false);
+                result = _parseDecimal(number.data() + start, length, counts, powers, 0);
+            }
+
+            result.isNegative = start == 1;
             result.removeLeadingZeros();
             return result;
         }
@@ -141,24 +2108,30 @@ namespace hsc_snippets {
          * Constructs a BigInteger from an integral type.
          * @tparam T The integral type of the input number.
          * @param number The number to be converted to a BigInteger.
+         * @param resource The memory resource for the limbs of the result, or nullptr for the global operator new.
          * @return A BigInteger instance representing the input number.
          */
         template<std::integral T>
-        static BigInteger from_integer(T number) {
-            if (number == std::numeric_limits<T>::min()) {
-                return BigInteger(getMinValueInstance<T>());
-            }
+        static BigInteger from_integer(T number, std::pmr::memory_resource *resource = nullptr) {
+            using U = std::make_unsigned_t<T>;
 
-            BigInteger result;
-            if (number < 0) {
-                result.isNegative = true;
-                number = -number; // Make number positive for processing
+            BigInteger result(resource);
+            auto magnitude = static_cast<U>(number);
+            if constexpr (std::is_signed_v<T>) {
+                if (number < 0) {
+                    result.isNegative = true;
+                    magnitude = static_cast<U>(0 - magnitude); // Well-defined even for the minimum value
+                }
             }
 
-            do {
-                result.digits.push_back(number % 10);
-                number /= 10;
-            } while (number > 0);
+            while (magnitude != 0) {
+                result.limbs.push_back(static_cast<Limb>(magnitude));
+                if constexpr (std::numeric_limits<U>::digits > LIMB_BITS) {
+                    magnitude >>= LIMB_BITS;
+                } else {
+                    magnitude = 0;
+                }
+            }
 
             return result;
         }
@@ -168,18 +2141,24 @@ namespace hsc_snippets {
          * @return A string representation of the BigInteger.
          */
         [[nodiscard]] std::string to_string() const {
-            if (digits.empty()) {
+            if (limbs.empty()) {
                 return "0";
             }
 
+            // Upper bound on the digit count: floor(bits * log10(2)) + 1
+            std::size_t digits = limbs.size() * LIMB_BITS * 30103 / 100000 + 1;
             std::string str;
+            str.reserve(digits + 1);
             if (isNegative) {
                 str += '-';
             }
-
-            str.reserve(digits.size() + str.size());
-            for (unsigned char digit: std::ranges::reverse_view(digits)) {
-                str += static_cast<char>('0' + digit);
+            if (limbs.size() < RADIX_CONVERSION_THRESHOLD) {
+                _appendDecimalChunks(str, limbs.data(), limbs.size(), 0);
+            } else {
+                std::vector<std::size_t> counts;
+                std::vector<const DecimalPower *> powers;
+                _decimalSplits(digits / DECIMAL_CHUNK_DIGITS + 1, counts, powers, true);
+                _appendDecimal(str, *this, counts, powers, 0, 0);
             }
             return str;
         }
@@ -196,8 +2175,8 @@ namespace hsc_snippets {
          */
         template<std::integral T>
         std::optional<T> to() const {
-            T result = 0;
-            T multiplier = 1;
+            using U = std::make_unsigned_t<T>;
+            constexpr int bits = std::numeric_limits<U>::digits;
 
             if constexpr (!std::is_signed_v<T>) {
                 if (isNegative) {
@@ -205,39 +2184,263 @@ namespace hsc_snippets {
                 }
             }
 
-            for (size_t i = 0; i < digits.size(); ++i) {
-                T digitValue = static_cast<T>(digits[i]);
-
-                // Check for potential overflow when adding the digit value
-                T tempResult = result + digitValue * multiplier;
-                if (tempResult < result) {
-                    return std::nullopt; // Overflow occurred during addition
-                }
-                result = tempResult;
-
-                // Check for potential overflow in the next multiplier
-                if (i < digits.size() - 1) {
-                    if (std::numeric_limits<T>::max() / 10 < multiplier) {
-                        return std::nullopt; // Next multiplier would overflow
+            U magnitude = 0;
+            for (std::size_t i = limbs.size(); i-- > 0;) {
+                if constexpr (bits > LIMB_BITS) {
+                    if ((magnitude >> (bits - LIMB_BITS)) != 0) {
+                        return std::nullopt; // Shifting in another limb would overflow
+                    }
+                    magnitude = static_cast<U>((magnitude << LIMB_BITS) | limbs[i]);
+                } else {
+                    if (magnitude != 0 || limbs[i] > std::numeric_limits<U>::max()) {
+                        return std::nullopt;
                     }
-                    multiplier *= 10;
+                    magnitude = static_cast<U>(limbs[i]);
                 }
             }
 
             if constexpr (std::is_signed_v<T>) {
+                constexpr auto maxMagnitude = static_cast<U>(std::numeric_limits<T>::max());
                 if (isNegative) {
-                    if (result == 0 || result > std::numeric_limits<T>::max()) {
+                    if (magnitude > maxMagnitude + 1) {
                         return std::nullopt; // Can't represent this negative value in T
                     }
-                    result = -result; // Negate the result
+                    return static_cast<T>(static_cast<U>(0 - magnitude));
+                }
+                if (magnitude > maxMagnitude) {
+                    return std::nullopt;
+                }
+            }
+
+            return static_cast<T>(magnitude);
+        }
+
+        /**
+         * Splits this BigInteger into a mantissa and a binary exponent like std::frexp: the value is approximately
+         * mantissa * 2^exponent with 0.5 <= |mantissa| < 1. The mantissa is the magnitude correctly rounded to double
+         * precision; it is computed from the top 64 bits plus a sticky bit for the rest, so the cost does not depend
+         * on the size of the value. The exponent is exact and does not overflow for any representable BigInteger.
+         *
+         * @return The pair (mantissa, exponent); (0.0, 0) for zero.
+         */
+        [[nodiscard]] std::pair<double, std::int64_t> frexp() const {
+            if (limbs.empty()) {
+                return {0.0, 0};
+            }
+
+            const std::size_t bits = bit_length();
+            std::uint64_t top;
+            if (bits <= 64) {
+                top = _lowWord() << (64 - bits);
+            } else {
+                // Top 64 bits; anything nonzero below them sets the lowest bit, which rounds ties away from the
+                // midpoint exactly as the dropped bits would
+                const std::size_t low = bits - 64;
+                const std::size_t i = low / LIMB_BITS;
+                const int offset = static_cast<int>(low % LIMB_BITS);
+                top = ((static_cast<std::uint64_t>(limbs[i + 1]) << LIMB_BITS) | limbs[i]) >> offset;
+                if (offset != 0) {
+                    top |= static_cast<std::uint64_t>(limbs[i + 2]) << (2 * LIMB_BITS - offset);
                 }
+                bool sticky = offset != 0 && (limbs[i] & ((Limb{1} << offset) - 1)) != 0;
+                for (std::size_t k = i; !sticky && k-- > 0;) {
+                    sticky = limbs[k] != 0;
+                }
+                top |= sticky ? 1 : 0;
+            }
+
+            // The conversion rounds to nearest even; rounding up may carry into the next power of two
+            double mantissa = std::ldexp(static_cast<double>(top), -64);
+            auto exponent = static_cast<std::int64_t>(bits);
+            if (mantissa == 1.0) {
+                mantissa = 0.5;
+                ++exponent;
+            }
+            return {isNegative ? -mantissa : mantissa, exponent};
+        }
+
+        /**
+         * Converts this BigInteger to the nearest double (ties to even), or to +/-infinity when the magnitude is beyond
+         * the range of double. Runs in constant time in practice; see `frexp`.
+         *
+         * @return The value of this BigInteger as a double.
+         */
+        [[nodiscard]] double to_double() const {
+            auto [mantissa, exponent] = frexp();
+            if (exponent > std::numeric_limits<double>::max_exponent) {
+                return isNegative ? -std::numeric_limits<double>::infinity() : std::numeric_limits<double>::infinity();
+            }
+            return std::ldexp(mantissa, static_cast<int>(exponent));
+        }
+
+        /**
+         * Constructs a BigInteger from a finite double, truncating the fractional part toward zero like a cast to
+         * an integer type. Every integral double is converted exactly.
+         *
+         * @param value The value to convert.
+         * @param resource The memory resource for the limbs of the result, or nullptr for the global operator new.
+         * @return The integral part of value as a BigInteger.
+         * @throws std::invalid_argument if value is NaN or infinite.
+         */
+        static BigInteger from_double(double value, std::pmr::memory_resource *resource = nullptr) {
+            if (!std::isfinite(value)) {
+                throw std::invalid_argument("Cannot convert NaN or infinity to BigInteger.");
+            }
+            int exponent = 0;
+            const double fraction = std::frexp(std::trunc(value), &exponent);
+            if (exponent <= 0) {
+                return BigInteger(resource); // |value| < 1
+            }
+
+            // 53 significant bits as an integer, then scaled by the remaining power of two
+            const auto mantissa = static_cast<std::int64_t>(std::ldexp(fraction, 53));
+            BigInteger result = from_integer(mantissa, resource);
+            if (exponent >= 53) {
+                result <<= static_cast<std::size_t>(exponent - 53);
+            } else {
+                result >>= static_cast<std::size_t>(53 - exponent); // Exact: the low bits are zero after trunc
+            }
+            return result;
+        }
+
+        /**
+         * Returns the number of bytes `export_bytes` produces for this value, i.e. ceil(bit_length() / 8).
+         */
+        [[nodiscard]] std::size_t byte_length() const {
+            return (bit_length() + 7) / 8;
+        }
+
+        /**
+         * Writes the magnitude of this BigInteger into `out` as little-endian bytes without leading zero bytes (zero
+         * writes nothing). The sign is not part of the output. Use `byte_length` to size the buffer.
+         *
+         * @param out The destination buffer, at least byte_length() bytes long.
+         * @return The number of bytes written.
+         * @throws std::length_error if the buffer is too small.
+         */
+        std::size_t export_bytes(std::span<std::byte> out) const {
+            const std::size_t count = byte_length();
+            if (out.size() < count) {
+                throw std::length_error("Buffer too small for BigInteger export.");
             }
+            const std::size_t whole = count / sizeof(Limb);
+            _storeLimbs(out.data(), limbs.data(), whole);
+            for (std::size_t k = whole * sizeof(Limb); k < count; ++k) {
+                out[k] = static_cast<std::byte>(limbs[whole] >> (8 * (k % sizeof(Limb))));
+            }
+            return count;
+        }
+
+        /**
+         * Returns the magnitude of this BigInteger as little-endian bytes without leading zero bytes.
+         *
+         * @return The byte representation of the magnitude; empty for zero.
+         */
+        [[nodiscard]] std::vector<std::byte> export_bytes() const {
+            std::vector<std::byte> out(byte_length());
+            export_bytes(out);
+            return out;
+        }
+
+        /**
+         * Builds a BigInteger from a little-endian magnitude, as produced by `export_bytes`. Leading zero bytes are
+         * allowed. On little-endian machines the bytes are copied straight into the limb buffer.
+         *
+         * @param bytes The little-endian magnitude.
+         * @param negative Whether the result is negative. Ignored when the magnitude is zero.
+         * @param resource The memory resource for the limbs of the result, or nullptr for the global operator new.
+         * @return The BigInteger with the given magnitude and sign.
+         */
+        static BigInteger import_bytes(std::span<const std::byte> bytes, bool negative = false,
+                                       std::pmr::memory_resource *resource = nullptr) {
+            BigInteger result(resource);
+            result.limbs.assign((bytes.size() + sizeof(Limb) - 1) / sizeof(Limb), 0);
+            _loadLimbs(result.limbs.data(), bytes.data(), bytes.size());
+            result.removeLeadingZeros();
+            result.isNegative = negative && !result.limbs.empty();
+            return result;
+        }
+
+        /**
+         * Serializes this BigInteger into a compact binary record: a LEB128 varint header holding
+         * (limb count << 1) | sign, followed by the limbs as 32-bit little-endian words. Records can be concatenated
+         * and read back one by one with `deserialize`.
+         *
+         * @param out The byte vector the record is appended to.
+         */
+        void serialize(std::vector<std::byte> &out) const {
+            _writeVarint(out, (static_cast<std::uint64_t>(limbs.size()) << 1) | (isNegative ? 1 : 0));
+            const std::size_t offset = out.size();
+            out.resize(offset + limbs.size() * sizeof(Limb));
+            _storeLimbs(out.data() + offset, limbs.data(), limbs.size());
+        }
+
+        /**
+         * Serializes this BigInteger into a new byte vector. See `serialize(std::vector<std::byte> &)`.
+         *
+         * @return The binary record of this value.
+         */
+        [[nodiscard]] std::vector<std::byte> serialize() const {
+            std::vector<std::byte> out;
+            out.reserve(limbs.size() * sizeof(Limb) + 10);
+            serialize(out);
+            return out;
+        }
 
+        /**
+         * Reads one binary record written by `serialize` from the front of `data`.
+         *
+         * @param data The bytes to read from.
+         * @param consumed If not null, receives the size of the record, i.e. where the next record starts.
+         * @param resource The memory resource for the limbs of the result, or nullptr for the global operator new.
+         * @return The deserialized BigInteger.
+         * @throws std::invalid_argument if the record is truncated or its header is malformed.
+         */
+        static BigInteger deserialize(std::span<const std::byte> data, std::size_t *consumed = nullptr,
+                                      std::pmr::memory_resource *resource = nullptr) {
+            std::size_t pos = 0;
+            const std::uint64_t header = _readVarint(data, pos);
+            const std::uint64_t count = header >> 1;
+            if (count > (data.size() - pos) / sizeof(Limb)) {
+                throw std::invalid_argument("Truncated BigInteger record.");
+            }
+            const auto bytes = static_cast<std::size_t>(count) * sizeof(Limb);
+            BigInteger result = import_bytes(data.subspan(pos, bytes), (header & 1) != 0, resource);
+            if (consumed != nullptr) {
+                *consumed = pos + bytes;
+            }
             return result;
         }
 
 #pragma endregion
 
+#pragma region memory resource
+
+        /**
+         * Copies a BigInteger into limbs allocated from the given memory resource, e.g. a
+         * std::pmr::monotonic_buffer_resource that serves a whole batch of computations and is released at once.
+         * Arithmetic results derived from the copy allocate from the same resource; plain copies of it do not (see the
+         * class comment).
+         *
+         * @param other The value to copy.
+         * @param resource The memory resource to allocate from, or nullptr for the global operator new.
+         */
+        BigInteger(const BigInteger &other, std::pmr::memory_resource *resource)
+            : limbs(other.limbs, resource), isNegative(other.isNegative) {
+        }
+
+        /**
+         * Returns the memory resource the limbs of this value are allocated from. Values that were not given a
+         * resource report std::pmr::new_delete_resource().
+         *
+         * @return The memory resource of this value.
+         */
+        [[nodiscard]] std::pmr::memory_resource *resource() const {
+            return limbs.resource() != nullptr ? limbs.resource() : std::pmr::new_delete_resource();
+        }
+
+#pragma endregion
+
 #pragma region singletons
 
         /**
@@ -246,7 +2449,7 @@ namespace hsc_snippets {
          */
 
         static const BigInteger &zero() {
-            static BigInteger zeroInstance(false, {0}); // Zero is not negative and has a single digit '0'
+            static BigInteger zeroInstance(false, {}); // Zero is not negative and has no limbs
             return zeroInstance;
         }
 
@@ -255,7 +2458,7 @@ namespace hsc_snippets {
          * @return A const reference to the BigInteger instance representing one.
          */
         static const BigInteger &one() {
-            static BigInteger oneInstance(false, {1}); // One is not negative and has a single digit '1'
+            static BigInteger oneInstance(false, {1}); // One is not negative and has a single limb '1'
             return oneInstance;
         }
 
@@ -264,7 +2467,7 @@ namespace hsc_snippets {
          * @return A const reference to the BigInteger instance representing two.
          */
         static const BigInteger &two() {
-            static BigInteger twoInstance(false, {2}); // Two is not negative and has a single digit '2'
+            static BigInteger twoInstance(false, {2}); // Two is not negative and has a single limb '2'
             return twoInstance;
         }
 
@@ -275,30 +2478,7 @@ namespace hsc_snippets {
          */
         template<std::integral T>
         static const BigInteger &getMinValueInstance() {
-            static BigInteger minValue = []() -> BigInteger {
-                if constexpr (std::is_signed_v<T>) {
-                    T number = std::numeric_limits<T>::min();
-                    BigInteger result;
-                    result.isNegative = true;
-
-                    // Special handling for the most negative number, which cannot be directly negated in signed types
-                    if (number == std::numeric_limits<T>::min()) {
-                        result.digits.push_back(-(number % 10));
-                        number /= 10;
-                        number = -number;
-                    }
-
-                    while (number > 0) {
-                        result.digits.push_back(number % 10);
-                        number /= 10;
-                    }
-
-                    return result;
-                } else {
-                    // For unsigned types, the minimum value is always 0
-                    return BigInteger::zero();
-                }
-            }();
+            static BigInteger minValue = from_integer(std::numeric_limits<T>::min());
 
             return minValue;
         }
@@ -310,18 +2490,7 @@ namespace hsc_snippets {
          */
         template<std::integral T>
         static const BigInteger &getMaxValueInstance() {
-            static BigInteger maxValue = []() -> BigInteger {
-                T number = std::numeric_limits<T>::max();
-                BigInteger result;
-                result.isNegative = false;
-
-                while (number > 0) {
-                    result.digits.push_back(number % 10);
-                    number /= 10;
-                }
-
-                return result;
-            }();
+            static BigInteger maxValue = from_integer(std::numeric_limits<T>::max());
 
             return maxValue; // Return a const reference to the singleton instance
         }
@@ -330,7 +2499,7 @@ namespace hsc_snippets {
 
         // Negates the BigInteger instance.
         void negate() {
-            if (digits.size() == 1 && digits[0] == 0) {
+            if (limbs.empty()) {
                 // Zero remains non-negative
                 isNegative = false;
             } else {
@@ -343,7 +2512,7 @@ namespace hsc_snippets {
          * @return A new BigInteger representing the absolute value, with the negative flag turned off.
          */
         [[nodiscard]] BigInteger abs() const {
-            BigInteger result = *this;
+            BigInteger result(*this, limbs.resource());
             result.isNegative = false; // Remove sign
             return result;
         }
@@ -351,7 +2520,7 @@ namespace hsc_snippets {
 
         // Unary minus operator to return the negated value of the BigInteger instance.
         BigInteger operator-() const {
-            BigInteger result = *this;
+            BigInteger result(*this, limbs.resource());
             result.negate();
             return result;
         }
@@ -364,29 +2533,38 @@ namespace hsc_snippets {
          * @param other The BigInteger instance to add to the current instance.
          * @return The result of adding the current instance to the other instance.
          */
-        BigInteger operator+(const BigInteger &other) const {
-            BigInteger result;
+        BigInteger operator+(const BigInteger &other) const & {
+            return _sum(*this, other, other.isNegative);
+        }
 
-            if (isNegative == other.isNegative) {
-                result = _add(other);
-                result.isNegative = isNegative; // Result will have the same sign
-            } else {
-                // Determine which number is greater in absolute value
-                if (_isAbsoluteGreaterOrEqual(other)) {
-                    result = _subtract(other);
-                    result.isNegative = isNegative;
-                } else {
-                    result = other._subtract(*this);
-                    result.isNegative = other.isNegative;
-                }
-            }
+        /**
+         * Adds a BigInteger to a temporary, reusing the temporary's limb buffer for the result.
+         * @param other The BigInteger instance to add to the current instance.
+         * @return The result of adding the current instance to the other instance.
+         */
+        BigInteger operator+(const BigInteger &other) && {
+            _accumulate(other, other.isNegative);
+            return std::move(*this);
+        }
 
-            result.removeLeadingZeros(); // Ensure there are no leading zeros
-            if (result.digits.size() == 1 && result.digits[0] == 0) {
-                result.isNegative = false; // Explicitly set the sign to non-negative for zero
-            }
+        /**
+         * Adds a temporary to this BigInteger, reusing the temporary's limb buffer for the result.
+         * @param other The temporary BigInteger to add to the current instance.
+         * @return The result of adding the current instance to the other instance.
+         */
+        BigInteger operator+(BigInteger &&other) const & {
+            other._accumulate(*this, isNegative);
+            return std::move(other);
+        }
 
-            return result;
+        /**
+         * Adds two temporaries, reusing the limb buffer of the left one for the result.
+         * @param other The temporary BigInteger to add to the current instance.
+         * @return The result of adding the current instance to the other instance.
+         */
+        BigInteger operator+(BigInteger &&other) && {
+            _accumulate(other, other.isNegative);
+            return std::move(*this);
         }
 
         /**
@@ -394,103 +2572,113 @@ namespace hsc_snippets {
          * @param other The BigInteger instance to subtract from the current instance.
          * @return The result of subtracting the other instance from the current instance.
          */
-        BigInteger operator-(const BigInteger &other) const {
-            BigInteger negatedOther = other;
-            negatedOther.isNegative = !other.isNegative; // Negate the second operand
-            return *this + negatedOther; // Use the + operator
+        BigInteger operator-(const BigInteger &other) const & {
+            return _sum(*this, other, !other.isNegative);
+        }
+
+        /**
+         * Subtracts a BigInteger from a temporary, reusing the temporary's limb buffer for the result.
+         * @param other The BigInteger instance to subtract from the current instance.
+         * @return The result of subtracting the other instance from the current instance.
+         */
+        BigInteger operator-(const BigInteger &other) && {
+            _accumulate(other, !other.isNegative);
+            return std::move(*this);
+        }
+
+        /**
+         * Subtracts a temporary from this BigInteger, reusing the temporary's limb buffer for the result.
+         * @param other The temporary BigInteger to subtract from the current instance.
+         * @return The result of subtracting the other instance from the current instance.
+         */
+        BigInteger operator-(BigInteger &&other) const & {
+            if (this == &other) {
+                return BigInteger(limbs.resource()); // x - std::move(x); negating other first would also negate *this
+            }
+            other.negate();
+            other._accumulate(*this, isNegative);
+            return std::move(other);
+        }
+
+        /**
+         * Subtracts a temporary from another temporary, reusing the limb buffer of the left one for the result.
+         * @param other The temporary BigInteger to subtract from the current instance.
+         * @return The result of subtracting the other instance from the current instance.
+         */
+        BigInteger operator-(BigInteger &&other) && {
+            _accumulate(other, !other.isNegative);
+            return std::move(*this);
         }
 
         /**
          * Multiplies this BigInteger with another BigInteger.
          *
-         * The method uses a classic grade-school multiplication algorithm, where each digit of the first number is
-         * multiplied by each digit of the second number, and the intermediate results are added together, taking care
-         * of the carry at each step. The result is stored in a temporary vector which is large enough to hold the maximum
-         * possible number of digits (sum of the number of digits in both numbers).
+         * The algorithm is chosen by operand size (in 32-bit limbs): the classic grade-school algorithm below
+         * KARATSUBA_THRESHOLD, Karatsuba below TOOM3_THRESHOLD and Toom-Cook 3-way above it. Operands of very
+         * different sizes are split into balanced pieces first. Multiplying a value by itself (`a * a`) takes a
+         * dedicated squaring path that computes every cross product only once.
          *
-         * Time Complexity: O(n*m), where n and m are the number of digits in the two numbers. This is because each digit
-         * of the first number is multiplied with each digit of the second number.
-         * Space Complexity: O(n + m), which is the size of the temporary vector used to store the intermediate results.
+         * Time Complexity: O(n*m) for small operands, O(n^1.585) with Karatsuba and O(n^1.465) with Toom-3,
+         * where n and m are the number of limbs in the two numbers.
+         * Space Complexity: O(n + m) for the result plus the temporaries of the recursion.
          *
          * @param other The BigInteger to multiply with this BigInteger.
          * @return The product of this BigInteger and the other BigInteger.
          */
         BigInteger operator*(const BigInteger &other) const {
-            // Check if either operand is zero
-            if (*this == BigInteger::zero() || other == BigInteger::zero()) {
-                return BigInteger::zero();
-            }
-
-            size_t totalLength = digits.size() + other.digits.size();
-            BigInteger result;
-            result.digits.resize(totalLength, 0); // Prepare the result vector with the appropriate size
-
-            // Perform the multiplication algorithm
-            for (size_t i = 0; i < digits.size(); ++i) {
-                int carry = 0;
-                for (size_t j = 0; j < other.digits.size() || carry; ++j) {
-                    int product = carry + result.digits[i + j];
-                    if (j < other.digits.size()) {
-                        product += digits[i] * other.digits[j];
-                    }
-                    result.digits[i + j] = product % 10;
-                    carry = product / 10;
-                }
-            }
-
-            result.removeLeadingZeros(); // Ensure the result is correctly processed for leading zeros
-            result.isNegative = isNegative != other.isNegative; // Determine the sign of the result
+            return _product(*this, other, 1);
+        }
 
-            return result;
+        /**
+         * Multiplies two BigIntegers with the recursion of the multiplication algorithms spread over several threads.
+         *
+         * The independent subproducts of Karatsuba (3), Toom-3 (5), unbalanced slicing and the three NTT primes are
+         * handed to fork-join tasks, and the thread budget is split between them as the recursion descends. Products
+         * whose smaller operand is below PARALLEL_MULTIPLICATION_THRESHOLD limbs stay on the calling thread, and every
+         * partial result is combined in a fixed order, so the result is identical to `a * b`. Threads only exist for
+         * the duration of the call; no pool or other global state is kept.
+         *
+         * @param a The first factor.
+         * @param b The second factor.
+         * @param threads The maximum number of threads to use, or 0 for std::thread::hardware_concurrency().
+         * @return The product a * b.
+         */
+        static BigInteger multiply(const BigInteger &a, const BigInteger &b, unsigned int threads) {
+            if (threads == 0) {
+                threads = std::max(1u, std::thread::hardware_concurrency());
+            }
+            return _product(a, b, threads);
         }
 
         /**
          * Divides this BigInteger by another BigInteger and returns the quotient.
          *
-         * The method uses a long division approach where the dividend is divided by the divisor starting from the highest
-         * order of magnitude down to the lowest. At each step, the method finds how many times the divisor fits into the
-         * current portion of the dividend and subtracts the corresponding multiple of the divisor from the dividend. The
-         * quotient is built digit by digit from these multiples.
+         * Single-limb divisors use a linear short division. Otherwise the operands are normalized and divided with
+         * Knuth's Algorithm D, which produces one quotient limb per step from a two-limb estimate. When both the
+         * divisor and the quotient have at least NEWTON_DIVISION_THRESHOLD limbs, the quotient is obtained by
+         * multiplying with a Newton-iterated reciprocal of the divisor instead. The quotient is truncated toward zero.
          *
-         * Time Complexity: For simplicity, let's denote this as O(d*(n-m)), where n is the number of digits in the dividend,
-         * m is the number of digits in the divisor, and d is the number of digits in the quotient. This accounts for the
-         * repeated subtraction of the divisor from portions of the dividend.
-         * Space Complexity: O(n), mainly for storing the quotient, where n is the number of digits in the dividend.
+         * Time Complexity: O(n) for single-limb divisors, O(m * (n - m)) with Algorithm D and a small multiple of
+         * the multiplication cost with Newton division, where n and m are the number of limbs of the dividend and
+         * the divisor.
+         * Space Complexity: O(n), mainly for storing the quotient.
          *
          * @param other The BigInteger divisor.
          * @return The quotient of dividing this BigInteger by the other BigInteger.
          * @throws std::runtime_error if attempted to divide by zero.
          */
         BigInteger operator/(const BigInteger &other) const {
-            if (other == BigInteger::zero()) {
+            if (other.limbs.empty()) {
                 throw std::runtime_error("Division by zero");
             }
 
-            BigInteger dividend = this->abs();
-            BigInteger divisor = other.abs();
-            BigInteger quotient;
-            BigInteger current;
-            quotient.digits.resize(dividend.digits.size(), 0);
-
-            for (int i = static_cast<int>(dividend.digits.size()) - 1; i >= 0; --i) {
-                current = current * BigInteger::from_integer(10) + BigInteger::from_integer(dividend.digits[i]);
-                int count = 0;
-                while (current >= divisor) {
-                    current = current - divisor;
-                    ++count;
-                }
-                quotient.digits[i] = count;
-            }
-
-            quotient.removeLeadingZeros(); // Remove any leading zeros
+            BigInteger quotient(limbs.resource());
+            LimbBuffer remainder(limbs.resource());
+            _divmodMagnitude(limbs, other.limbs, quotient.limbs, remainder);
 
-            // After calculating the quotient, if it is zero, its sign should be positive
-            if (quotient == BigInteger::zero()) {
-                quotient.isNegative = false;
-            } else {
-                // Otherwise, the sign of the quotient is determined by the signs of the operands
-                quotient.isNegative = isNegative != other.isNegative;
-            }
+            // The sign of the quotient is determined by the signs of the operands; zero stays positive
+            quotient.isNegative = isNegative != other.isNegative;
+            quotient.removeLeadingZeros();
 
             return quotient;
         }
@@ -499,45 +2687,80 @@ namespace hsc_snippets {
         /**
          * Adds the value of another BigInteger to this instance and updates this instance with the result.
          *
-         * This operator modifies the current instance by adding the value of the specified BigInteger ('other')
-         * to it. The addition is performed using the existing addition logic defined in the class, which handles
-         * the arithmetic and any necessary carry operation. After the addition, the current instance is updated
-         * with the new value, making this operation in-place.
+         * The addition is carried out directly in the limb buffer of this instance: the buffer is only extended
+         * when the other operand is longer or a carry leaves the top limb, so accumulating into the same
+         * variable in a loop reuses its storage instead of allocating a new result each time.
          *
          * @param other The BigInteger to add to this instance.
          * @return A reference to this instance after the addition.
          */
         BigInteger &operator+=(const BigInteger &other) {
-            // Use the existing addition logic (_add method, or however addition is implemented in your class)
-            *this = *this + other; // This line might change depending on how you've implemented addition internally
-            return *this; // Return the current instance after modification
+            _accumulate(other, other.isNegative);
+            return *this;
         }
 
         /**
          * Subtracts the value of another BigInteger from this instance and updates this instance with the result.
          *
-         * This operator modifies the current instance by subtracting the value of the specified BigInteger ('other')
-         * from it. The subtraction is performed using the existing subtraction logic defined in the class, which
-         * handles the arithmetic and any necessary borrow operation. After the subtraction, the current instance is
-         * updated with the new value, making this operation in-place.
+         * Like operator+=, the subtraction works in place on the limb buffer of this instance, extending it only
+         * when the other operand is longer.
          *
          * @param other The BigInteger to subtract from this instance.
          * @return A reference to this instance after the subtraction.
          */
         BigInteger &operator-=(const BigInteger &other) {
-            // Use the existing subtraction logic (_subtract method, or however subtraction is implemented in your class)
-            *this = *this - other; // This line might change depending on how you've implemented subtraction internally
-            return *this; // Return the current instance after modification
+            _accumulate(other, !other.isNegative);
+            return *this;
+        }
+
+        /**
+         * Adds the product a * b to this instance (fused multiply-add).
+         *
+         * When one factor is short (below KARATSUBA_THRESHOLD limbs) the partial products are accumulated straight
+         * into the limb buffer of this instance, so `r.addmul(a, b)` allocates at most a one-time growth of `r`
+         * instead of the product temporary and the new sum that `r += a * b` creates. Longer factors compute the
+         * product once and add it in place.
+         *
+         * @param a The first factor.
+         * @param b The second factor.
+         * @return A reference to this instance after the update.
+         */
+        BigInteger &addmul(const BigInteger &a, const BigInteger &b) {
+            _accumulateProduct(a, b, false);
+            return *this;
+        }
+
+        /**
+         * Subtracts the product a * b from this instance (fused multiply-subtract). See `addmul`.
+         *
+         * @param a The first factor.
+         * @param b The second factor.
+         * @return A reference to this instance after the update.
+         */
+        BigInteger &submul(const BigInteger &a, const BigInteger &b) {
+            _accumulateProduct(a, b, true);
+            return *this;
         }
 
 
         /**
          * Multiplies the current BigInteger by another BigInteger and assigns the result to the current object.
          *
+         * Single-limb multipliers scale the limb buffer in place. Larger products need a separate output
+         * buffer, which is moved into this instance without copying.
+         *
          * @param other The BigInteger to multiply with the current BigInteger.
          * @return A reference to the current BigInteger after multiplication.
          */
         BigInteger &operator*=(const BigInteger &other) {
+            if (other.limbs.size() == 1 && !limbs.empty()) {
+                Limb carry = _multiplyAddSmall(limbs.data(), limbs.size(), other.limbs[0], 0);
+                if (carry != 0) {
+                    limbs.push_back(carry);
+                }
+                isNegative = isNegative != other.isNegative;
+                return *this;
+            }
             *this = *this * other;
             return *this;
         }
@@ -545,10 +2768,19 @@ namespace hsc_snippets {
         /**
          * Divides the current BigInteger by another BigInteger and assigns the result to the current object.
          *
+         * Single-limb divisors divide the limb buffer in place; otherwise the quotient is moved into this instance.
+         *
          * @param other The BigInteger to divide the current BigInteger by.
          * @return A reference to the current BigInteger after division.
+         * @throws std::runtime_error if attempted to divide by zero.
          */
         BigInteger &operator/=(const BigInteger &other) {
+            if (other.limbs.size() == 1) {
+                _divideSmall(limbs.data(), limbs.size(), other.limbs[0]);
+                isNegative = isNegative != other.isNegative;
+                removeLeadingZeros();
+                return *this;
+            }
             *this = *this / other;
             return *this;
         }
@@ -566,13 +2798,17 @@ namespace hsc_snippets {
          * @throws std::runtime_error If attempting to perform modulo by zero.
          */
         BigInteger operator%(const BigInteger &other) const {
-            if (other == BigInteger::zero()) {
+            if (other.limbs.empty()) {
                 throw std::runtime_error("Modulo by zero");
             }
 
-            BigInteger quotient = *this / other;
-            BigInteger product = quotient * other;
-            BigInteger remainder = *this - product;
+            LimbBuffer quotient(limbs.resource());
+            BigInteger remainder(limbs.resource());
+            _divmodMagnitude(limbs, other.limbs, quotient, remainder.limbs);
+
+            // Truncated division: the remainder takes the sign of the dividend
+            remainder.isNegative = isNegative;
+            remainder.removeLeadingZeros();
 
             return remainder;
         }
@@ -583,27 +2819,31 @@ namespace hsc_snippets {
          * Performs division and modulo operations simultaneously, returning both the quotient and the remainder.
          *
          * This method divides this BigInteger by another BigInteger (divisor) and returns a pair consisting
-         * of the quotient and the remainder. It is more efficient than performing division and modulo operations
-         * separately. If the divisor is zero, the method throws a runtime error due to division by zero being undefined.
+         * of the quotient and the remainder, both produced by a single pass of the division algorithm. If the divisor
+         * is zero, the method throws a runtime error due to division by zero being undefined.
          *
-         * The remainder's sign is adjusted to match the divisor's sign, following the standard mathematical convention
-         * for division and modulus operations. This ensures that the remainder has the same sign as the divisor or is
-         * non-negative if the divisor is positive.
+         * The quotient is truncated toward zero and the remainder takes the sign of the dividend, matching the
+         * behavior of the built-in integer operators, so that `quotient * other + remainder == *this`.
          *
          * @param other The divisor in the division and modulo operations.
          * @return A std::pair containing the quotient (first element) and the remainder (second element) of the division.
          * @throws std::runtime_error If attempting division by zero in the divmod operation.
          */
         [[nodiscard]] std::pair<BigInteger, BigInteger> divmod(const BigInteger &other) const {
-            if (other == BigInteger::zero()) {
+            if (other.limbs.empty()) {
                 throw std::runtime_error("Modulo by zero");
             }
 
-            BigInteger quotient = *this / other;
-            BigInteger product = quotient * other;
-            BigInteger remainder = *this - product;
+            BigInteger quotient(limbs.resource());
+            BigInteger remainder(limbs.resource());
+            _divmodMagnitude(limbs, other.limbs, quotient.limbs, remainder.limbs);
 
-            return std::make_pair(quotient, remainder);
+            quotient.isNegative = isNegative != other.isNegative;
+            quotient.removeLeadingZeros();
+            remainder.isNegative = isNegative;
+            remainder.removeLeadingZeros();
+
+            return std::make_pair(std::move(quotient), std::move(remainder));
         }
 
         /**
@@ -642,26 +2882,26 @@ namespace hsc_snippets {
 
         // Prefix increment
         BigInteger &operator++() {
-            *this = *this + BigInteger::one();
+            _accumulate(BigInteger::one(), false);
             return *this;
         }
 
         // Postfix increment
         BigInteger operator++(int) {
-            BigInteger temp = *this;
+            BigInteger temp(*this, limbs.resource());
             ++(*this); // Use prefix increment
             return temp;
         }
 
         // Prefix decrement
         BigInteger &operator--() {
-            *this = *this - BigInteger::one();
+            _accumulate(BigInteger::one(), true);
             return *this;
         }
 
         // Postfix decrement
         BigInteger operator--(int) {
-            BigInteger temp = *this;
+            BigInteger temp(*this, limbs.resource());
             --(*this); // Use prefix decrement
             return temp;
         }
@@ -673,7 +2913,7 @@ namespace hsc_snippets {
 
         // Equality comparator
         bool operator==(const BigInteger &other) const {
-            return isNegative == other.isNegative && digits == other.digits;
+            return isNegative == other.isNegative && limbs == other.limbs;
         }
 
         // Inequality comparator
@@ -687,17 +2927,8 @@ namespace hsc_snippets {
                 return isNegative; // If *this is negative and other is positive, *this is smaller
             }
 
-            if (digits.size() != other.digits.size()) {
-                return isNegative ? digits.size() > other.digits.size() : digits.size() < other.digits.size();
-            }
-
-            for (int i = static_cast<int>(digits.size()) - 1; i >= 0; --i) {
-                if (digits[i] != other.digits[i]) {
-                    return isNegative ? digits[i] > other.digits[i] : digits[i] < other.digits[i];
-                }
-            }
-
-            return false; // Numbers are equal, so *this is not less than other
+            int cmp = _compareLimbs(limbs.data(), limbs.size(), other.limbs.data(), other.limbs.size());
+            return isNegative ? cmp > 0 : cmp < 0; // Equal numbers are not less than each other
         }
 
         // Less than or equal comparator
@@ -715,33 +2946,203 @@ namespace hsc_snippets {
             return !(*this < other);
         }
 
+#pragma endregion
+
+#pragma region bitwise operations
+
+        /*
+         * Bitwise operators follow the semantics of an infinite two's complement representation, like the built-in
+         * operators on signed integers: -1 has all bits set, ~x == -x - 1 and x >> k rounds toward negative infinity.
+         * All of them run in a single pass over the limbs.
+         */
+
+        // Shifts left by `shift` bits, i.e. multiplies by 2^shift
+        BigInteger &operator<<=(std::size_t shift) {
+            if (limbs.empty()) {
+                return *this;
+            }
+            const std::size_t whole = shift / LIMB_BITS;
+            const int bits = static_cast<int>(shift % LIMB_BITS);
+            const std::size_t n = limbs.size();
+            limbs.resize(n + whole + 1);
+            Limb *data = limbs.data();
+            data[n + whole] = _shiftLeftBits(data + whole, data, n, bits);
+            std::fill(data, data + whole, 0);
+            removeLeadingZeros();
+            return *this;
+        }
+
+        // Arithmetic right shift by `shift` bits, i.e. floor division by 2^shift
+        BigInteger &operator>>=(std::size_t shift) {
+            const bool negative = isNegative;
+            const std::size_t whole = shift / LIMB_BITS;
+            const int bits = static_cast<int>(shift % LIMB_BITS);
+            if (whole >= limbs.size()) {
+                limbs.clear();
+                isNegative = false;
+                return negative ? (*this = -one()) : *this;
+            }
+
+            // Negative values round toward negative infinity when any shifted-out bit is set
+            bool inexact = false;
+            if (negative) {
+                inexact = std::any_of(limbs.begin(), limbs.begin() + whole, [](Limb limb) { return limb != 0; })
+                          || (limbs[whole] & ((Limb{1} << bits) - 1)) != 0;
+            }
+
+            const std::size_t n = limbs.size() - whole;
+            _shiftRightBits(limbs.data(), limbs.data() + whole, n, bits);
+            limbs.resize(n);
+            removeLeadingZeros();
+            if (inexact) {
+                isNegative = !limbs.empty();
+                _accumulate(one(), true);
+            }
+            return *this;
+        }
+
+        BigInteger operator<<(std::size_t shift) const {
+            BigInteger result(*this, limbs.resource());
+            result <<= shift;
+            return result;
+        }
+
+        BigInteger operator>>(std::size_t shift) const {
+            BigInteger result(*this, limbs.resource());
+            result >>= shift;
+            return result;
+        }
+
+        BigInteger &operator&=(const BigInteger &other) {
+            _applyBitwise(other, std::bit_and<Limb>());
+            return *this;
+        }
+
+        BigInteger &operator|=(const BigInteger &other) {
+            _applyBitwise(other, std::bit_or<Limb>());
+            return *this;
+        }
+
+        BigInteger &operator^=(const BigInteger &other) {
+            _applyBitwise(other, std::bit_xor<Limb>());
+            return *this;
+        }
+
+        BigInteger operator&(const BigInteger &other) const {
+            BigInteger result(*this, limbs.resource());
+            result &= other;
+            return result;
+        }
+
+        BigInteger operator|(const BigInteger &other) const {
+            BigInteger result(*this, limbs.resource());
+            result |= other;
+            return result;
+        }
+
+        BigInteger operator^(const BigInteger &other) const {
+            BigInteger result(*this, limbs.resource());
+            result ^= other;
+            return result;
+        }
+
+        // Bitwise complement, equal to -x - 1
+        BigInteger operator~() const {
+            BigInteger result = -*this;
+            result._accumulate(one(), true);
+            return result;
+        }
+
+        /**
+         * Returns the number of bits needed to represent the magnitude, i.e. floor(log2(|x|)) + 1, or 0 for zero.
+         */
+        [[nodiscard]] std::size_t bit_length() const {
+            if (limbs.empty()) {
+                return 0;
+            }
+            return limbs.size() * LIMB_BITS - static_cast<std::size_t>(std::countl_zero(limbs.back()));
+        }
+
+        /**
+         * Returns the number of one bits in the magnitude |x|.
+         */
+        [[nodiscard]] std::size_t popcount() const {
+            std::size_t count = 0;
+            for (Limb limb: limbs) {
+                count += static_cast<std::size_t>(std::popcount(limb));
+            }
+            return count;
+        }
+
+        /**
+         * Tests bit `n` of the two's complement representation, equivalent to ((x >> n) & 1) != 0.
+         */
+        [[nodiscard]] bool test_bit(std::size_t n) const {
+            const std::size_t index = n / LIMB_BITS;
+            const bool bit = index < limbs.size() && ((limbs[index] >> (n % LIMB_BITS)) & 1) != 0;
+            if (!isNegative) {
+                return bit;
+            }
+
+            // Bit n of ~(|x| - 1): subtracting one flips bit n exactly when all lower bits of |x| are zero
+            std::size_t lowest = 0;
+            while (limbs[lowest / LIMB_BITS] == 0) {
+                lowest += LIMB_BITS;
+            }
+            lowest += static_cast<std::size_t>(std::countr_zero(limbs[lowest / LIMB_BITS]));
+            return bit == (lowest >= n);
+        }
+
 #pragma endregion
 
         /**
-         * Calculates the Greatest Common Divisor (GCD) of two BigInteger values using the Euclidean algorithm.
+         * Calculates the Greatest Common Divisor (GCD) of two BigInteger values using Lehmer's algorithm.
          *
-         * The Euclidean algorithm is based on the principle that the gcd of two numbers also divides their difference.
-         * This method repeatedly replaces the larger number by its difference with the smaller number until one of
-         * the numbers becomes zero. The non-zero number at this point is the gcd of the original two numbers.
+         * Lehmer's algorithm runs the Euclidean algorithm on the leading limbs of both numbers with machine-word
+         * cofactors and only touches the full numbers once per batch of quotient steps, instead of performing a long
+         * division for every step. Once the values fit into a machine word the binary (Stein's) algorithm finishes
+         * the computation. The result is always non-negative, and gcd(0, 0) is 0.
          *
          * @param a The first BigInteger for which to find the gcd.
          * @param b The second BigInteger for which to find the gcd.
          * @return The gcd of BigInteger a and BigInteger b.
          */
         static BigInteger gcd(const BigInteger &a, const BigInteger &b) {
-            BigInteger zero = BigInteger::from_integer(0);
-            BigInteger x = a.abs(); // Work with absolute values to ensure non-negativity
-            BigInteger y = b.abs();
+            bool ordered = _compareLimbs(a.limbs.data(), a.limbs.size(), b.limbs.data(), b.limbs.size()) >= 0;
+            const LimbBuffer &u = ordered ? a.limbs : b.limbs;
+            const LimbBuffer &v = ordered ? b.limbs : a.limbs;
+            if (v.empty()) {
+                return {false, u};
+            }
+            return {false, _gcdMagnitude(u, v, nullptr, nullptr)};
+        }
 
-            while (y != zero) {
-                BigInteger temp = y;
-                y = x % y; // Replace y with the remainder of x divided by y
-                x = temp; // Replace x with the old value of y
+        /**
+         * Calculates the gcd of two BigInteger values together with Bezout coefficients.
+         *
+         * Returns (g, x, y) such that a * x + b * y == g, where g = gcd(a, b) is non-negative. The coefficient of a is
+         * tracked through the same Lehmer steps used by `gcd`; the coefficient of b is recovered with one exact
+         * division at the end.
+         *
+         * @param a The first BigInteger.
+         * @param b The second BigInteger.
+         * @return A std::tuple containing the gcd and the coefficients of a and b, in that order.
+         */
+        static std::tuple<BigInteger, BigInteger, BigInteger> extended_gcd(const BigInteger &a, const BigInteger &b) {
+            if (b.limbs.empty()) {
+                return {a.abs(), a.limbs.empty() ? zero() : from_integer(a.isNegative ? -1 : 1), zero()};
             }
 
-            return x; // x contains the gcd when y becomes zero
-        }
+            bool ordered = _compareLimbs(a.limbs.data(), a.limbs.size(), b.limbs.data(), b.limbs.size()) >= 0;
+            BigInteger su = ordered ? one() : zero();
+            BigInteger sv = ordered ? zero() : one();
+            BigInteger g(false, ordered ? _gcdMagnitude(a.limbs, b.limbs, &su, &sv)
+                                        : _gcdMagnitude(b.limbs, a.limbs, &su, &sv));
 
+            BigInteger x = a.isNegative ? -su : su;
+            BigInteger y = (g - a * x) / b;
+            return {std::move(g), std::move(x), std::move(y)};
+        }
 
         /**
          * Calculates the Least Common Multiple (LCM) of two BigInteger values using the formula lcm(a, b) = |a * b| / gcd(a, b).
@@ -768,22 +3169,60 @@ namespace hsc_snippets {
 
         /**
          * Calculates the factorial of a non-negative integer.
+         * The odd part is built with the prime swing recursion over the primes up to n, and every partial product is
+         * formed by a balanced product tree; the power of two n - popcount(n) is applied as a single shift.
          *
          * @param n The non-negative integer for which to compute the factorial.
          * @return The factorial of n as a BigInteger.
+         * @throws std::length_error if n exceeds half the range of int, the limit of the prime sieve.
          */
         static BigInteger factorial(unsigned int n) {
-            BigInteger result = BigInteger::from_integer(1); // Start with 1 as 0! = 1 and 1! = 1
+            std::vector<int> primes;
+            if (n >= 21) {
+                primes = _primesUpTo(n);
+                primes.erase(primes.begin()); // Powers of two are shifted in at the end
+            }
+            BigInteger result = _oddFactorial(n, primes);
+            result <<= static_cast<std::size_t>(n - static_cast<unsigned int>(std::popcount(n)));
+            return result;
+        }
 
-            for (unsigned int i = 2; i <= n; ++i) {
-                result = result * BigInteger::from_integer(i); // Multiply result by i for each step from 2 to n
+        /**
+         * Calculates the binomial coefficient C(n, k), the number of k-element subsets of an n-element set.
+         * The exponent of each prime p <= n is taken from Legendre's formula, and the prime powers are multiplied
+         * by a balanced product tree.
+         *
+         * @param n The size of the set.
+         * @param k The size of the subsets.
+         * @return C(n, k) as a BigInteger, or zero if k > n.
+         * @throws std::length_error if n exceeds half the range of int, the limit of the prime sieve.
+         */
+        static BigInteger binomial(unsigned int n, unsigned int k) {
+            if (k > n) {
+                return zero();
+            }
+            k = std::min(k, n - k);
+            if (k == 0) {
+                return one();
             }
 
-            return result;
+            std::vector<std::uint64_t> words;
+            for (int prime: _primesUpTo(n)) {
+                const auto p = static_cast<std::uint64_t>(prime);
+                unsigned int exponent = 0;
+                for (std::uint64_t power = p; power <= n; power *= p) {
+                    exponent += static_cast<unsigned int>(n / power - k / power - (n - k) / power);
+                }
+                for (unsigned int i = 0; i < exponent; ++i) {
+                    _appendFactor(words, p);
+                }
+            }
+            return _productTree(words, 0, words.size());
         }
 
         /**
          * Computes a raised to the power of n using the fast powering algorithm.
+         * The base is squared in every step, which uses the dedicated squaring path of operator*.
          *
          * @param a The base as a BigInteger.
          * @param n The exponent as an unsigned integer.
@@ -808,49 +3247,459 @@ namespace hsc_snippets {
             return result;
         }
 
+#pragma region modular arithmetic
+
+        /**
+         * @class MontgomeryContext
+         * @brief Precomputed data for Montgomery multiplication modulo a fixed odd modulus m.
+         *
+         * With n the limb count of m and R = 2^(32n), a value x is represented by x * R mod m. The product of two
+         * represented values is brought back into range by Montgomery reduction (REDC), which replaces the division
+         * by m with n single-limb multiply-accumulate passes. Building a context costs two divisions; afterwards it can
+         * be reused for any number of multiplications and exponentiations with the same modulus.
+         */
+        class MontgomeryContext {
+        private:
+            LimbBuffer modulusLimbs;
+            Limb inverse = 0; // -m^-1 mod 2^32
+            LimbBuffer rSquared; // R^2 mod m, padded to n limbs
+
+            [[nodiscard]] std::size_t _size() const {
+                return modulusLimbs.size();
+            }
+
+            // Returns x reduced into [0, m) and zero-padded to n limbs.
+            [[nodiscard]] LimbBuffer _reduced(const BigInteger &x) const {
+                BigInteger remainder = x % BigInteger(false, modulusLimbs);
+                if (remainder.isNegative) {
+                    remainder += BigInteger(false, modulusLimbs);
+                }
+                remainder.limbs.resize(_size());
+                return std::move(remainder.limbs);
+            }
+
+            // r[0..n) = a * b * R^-1 mod m for n-limb a, b < m. r may alias a or b; scratch is resized as needed.
+            void _multiply(Limb *r, const Limb *a, const Limb *b, LimbBuffer &scratch) const {
+                const std::size_t n = _size();
+                const Limb *m = modulusLimbs.data();
+                scratch.resize(2 * n + 1);
+                Limb *t = scratch.data();
+                _multiplyLimbs(t, a, n, b, n);
+                t[2 * n] = 0;
+
+                // REDC: clear one low limb per pass by adding a multiple of m; t < 2 * m * R afterwards
+                for (std::size_t i = 0; i < n; ++i) {
+                    const DoubleLimb u = static_cast<Limb>(t[i] * inverse);
+                    DoubleLimb carry = 0;
+                    for (std::size_t j = 0; j < n; ++j) {
+                        carry += u * m[j] + t[i + j];
+                        t[i + j] = static_cast<Limb>(carry);
+                        carry >>= LIMB_BITS;
+                    }
+                    for (std::size_t k = i + n; carry != 0; ++k) {
+                        carry += t[k];
+                        t[k] = static_cast<Limb>(carry);
+                        carry >>= LIMB_BITS;
+                    }
+                }
+
+                if (_subtractLimbs(t + n, t + n, n + 1, m, n) != 0) {
+                    _addLimbs(t + n, t + n, n + 1, m, n);
+                }
+                std::copy(t + n, t + 2 * n, r);
+            }
+
+            [[nodiscard]] BigInteger _toBigInteger(LimbBuffer limbs) const {
+                BigInteger result(false, std::move(limbs));
+                result.removeLeadingZeros();
+                return result;
+            }
+
+        public:
+            /**
+             * Creates a context for the given modulus.
+             *
+             * @param modulus An odd, positive modulus.
+             * @throws std::invalid_argument If the modulus is even, zero or negative.
+             */
+            explicit MontgomeryContext(const BigInteger &modulus) : modulusLimbs(modulus.limbs) {
+                if (modulus.isNegative || modulus.limbs.empty() || (modulus.limbs[0] & 1) == 0) {
+                    throw std::invalid_argument("Montgomery modulus must be odd and positive.");
+                }
+
+                // Newton iteration for m0^-1 mod 2^32; every step doubles the number of correct low bits
+                Limb m0 = modulusLimbs[0];
+                Limb x = m0; // Correct to 3 bits for any odd m0
+                for (int i = 0; i < 4; ++i) {
+                    x *= 2 - m0 * x;
+                }
+                inverse = 0 - x;
+
+                BigInteger r = BigInteger::one() << (_size() * LIMB_BITS);
+                rSquared = _reduced(r * r);
+            }
+
+            /**
+             * @return The modulus of this context.
+             */
+            [[nodiscard]] BigInteger modulus() const {
+                return {false, modulusLimbs};
+            }
+
+            /**
+             * Converts x (any value, reduced modulo m first) into Montgomery form x * R mod m.
+             */
+            [[nodiscard]] BigInteger to_montgomery(const BigInteger &x) const {
+                LimbBuffer value = _reduced(x);
+                LimbBuffer scratch;
+                _multiply(value.data(), value.data(), rSquared.data(), scratch);
+                return _toBigInteger(std::move(value));
+            }
+
+            /**
+             * Converts a value in Montgomery form back to the ordinary residue in [0, m).
+             */
+            [[nodiscard]] BigInteger from_montgomery(const BigInteger &x) const {
+                LimbBuffer value = _reduced(x);
+                LimbBuffer unit;
+                unit.assign(_size(), 0);
+                unit[0] = 1;
+                LimbBuffer scratch;
+                _multiply(value.data(), value.data(), unit.data(), scratch);
+                return _toBigInteger(std::move(value));
+            }
+
+            /**
+             * Multiplies two values in Montgomery form, returning a * b * R^-1 mod m (again in Montgomery form).
+             */
+            [[nodiscard]] BigInteger multiply(const BigInteger &a, const BigInteger &b) const {
+                LimbBuffer x = _reduced(a);
+                LimbBuffer y = _reduced(b);
+                LimbBuffer scratch;
+                _multiply(x.data(), x.data(), y.data(), scratch);
+                return _toBigInteger(std::move(x));
+            }
+
+            /**
+             * Computes base^exponent mod m using left-to-right sliding-window exponentiation on Montgomery forms.
+             * Windows of up to 6 bits (chosen from the exponent length) take one table multiplication each, the table
+             * holding the odd powers of the base.
+             *
+             * @param base The base; negative values are reduced into [0, m) first.
+             * @param exponent A non-negative exponent.
+             * @return base^exponent mod m, in [0, m).
+             * @throws std::invalid_argument If the exponent is negative.
+             */
+            [[nodiscard]] BigInteger pow(const BigInteger &base, const BigInteger &exponent) const {
+                if (exponent.isNegative) {
+                    throw std::invalid_argument("Exponent must be non-negative.");
+                }
+                const std::size_t n = _size();
+                const std::size_t bits = exponent.bit_length();
+                if (bits == 0) {
+                    return BigInteger::one() % modulus();
+                }
+
+                const std::size_t window = bits > 671 ? 6 : bits > 239 ? 5 : bits > 79 ? 4 : bits > 23 ? 3 : bits > 7 ? 2 : 1;
+                LimbBuffer scratch;
+
+                // table[i] = base^(2i + 1) in Montgomery form
+                std::vector<LimbBuffer> table(std::size_t{1} << (window - 1));
+                table[0] = _reduced(base);
+                _multiply(table[0].data(), table[0].data(), rSquared.data(), scratch);
+                if (table.size() > 1) {
+                    LimbBuffer square;
+                    square.assign(n, 0);
+                    _multiply(square.data(), table[0].data(), table[0].data(), scratch);
+                    for (std::size_t i = 1; i < table.size(); ++i) {
+                        table[i].resize(n);
+                        _multiply(table[i].data(), table[i - 1].data(), square.data(), scratch);
+                    }
+                }
+
+                LimbBuffer result;
+                bool started = false;
+                for (std::size_t i = bits; i-- > 0;) {
+                    if (!exponent.test_bit(i)) {
+                        if (started) {
+                            _multiply(result.data(), result.data(), result.data(), scratch);
+                        }
+                        continue;
+                    }
+
+                    // The window [low, i] ends with a set bit, so its value is odd
+                    std::size_t low = i + 1 >= window ? i + 1 - window : 0;
+                    while (!exponent.test_bit(low)) {
+                        ++low;
+                    }
+                    std::size_t value = 0;
+                    for (std::size_t j = i + 1; j-- > low;) {
+                        value = value * 2 + (exponent.test_bit(j) ? 1 : 0);
+                    }
+
+                    if (started) {
+                        for (std::size_t j = low; j <= i; ++j) {
+                            _multiply(result.data(), result.data(), result.data(), scratch);
+                        }
+                        _multiply(result.data(), result.data(), table[value >> 1].data(), scratch);
+                    } else {
+                        result = table[value >> 1];
+                        started = true;
+                    }
+                    i = low;
+                }
+
+                LimbBuffer unit;
+                unit.assign(n, 0);
+                unit[0] = 1;
+                _multiply(result.data(), result.data(), unit.data(), scratch);
+                return _toBigInteger(std::move(result));
+            }
+        };
+
+        /**
+         * Computes base^exponent mod modulus without ever forming the full power.
+         *
+         * Odd moduli use Montgomery multiplication with sliding-window exponentiation (see MontgomeryContext); even
+         * moduli fall back to binary square-and-multiply with a long division after every step. The result is
+         * always in [0, modulus), also for negative bases.
+         *
+         * @param base The base.
+         * @param exponent A non-negative exponent.
+         * @param modulus A positive modulus.
+         * @return base^exponent mod modulus.
+         * @throws std::invalid_argument If the modulus is not positive or the exponent is negative.
+         */
+        static BigInteger pow_mod(const BigInteger &base, const BigInteger &exponent, const BigInteger &modulus) {
+            if (modulus.isNegative || modulus.limbs.empty()) {
+                throw std::invalid_argument("Modulus must be positive.");
+            }
+            if (exponent.isNegative) {
+                throw std::invalid_argument("Exponent must be non-negative.");
+            }
+            if ((modulus.limbs[0] & 1) != 0) {
+                return MontgomeryContext(modulus).pow(base, exponent);
+            }
+
+            BigInteger b = base % modulus;
+            if (b.isNegative) {
+                b += modulus;
+            }
+            BigInteger result = BigInteger::one() % modulus;
+            for (std::size_t i = exponent.bit_length(); i-- > 0;) {
+                result = result * result % modulus;
+                if (exponent.test_bit(i)) {
+                    result = result * b % modulus;
+                }
+            }
+            return result;
+        }
+
+        /**
+         * Computes base^exponent mod modulus for a machine-word exponent.
+         *
+         * @param base The base.
+         * @param exponent The exponent.
+         * @param modulus A positive modulus.
+         * @return base^exponent mod modulus.
+         * @throws std::invalid_argument If the modulus is not positive.
+         */
+        static BigInteger pow_mod(const BigInteger &base, std::uint64_t exponent, const BigInteger &modulus) {
+            return pow_mod(base, from_integer(exponent), modulus);
+        }
+
+#pragma endregion
+
         /**
          * Calculates the square root of a BigInteger.
          *
          * @param number The BigInteger to find the square root of.
-         * @return The square root of the given BigInteger.
+         * @return The square root of the given BigInteger, rounded down.
          * @throws std::runtime_error if the given BigInteger is negative.
          */
         static BigInteger sqrt(const BigInteger &number) {
+            return sqrt_rem(number).first;
+        }
+
+        /**
+         * Calculates the integer square root together with its remainder using Zimmermann's Karatsuba square root.
+         *
+         * The recursion halves the operand at every level and only needs one division and one squaring per level,
+         * so the total cost stays within a constant factor of a single multiplication of the full size.
+         *
+         * @param number A non-negative BigInteger.
+         * @return A std::pair (s, r) with s = floor(sqrt(number)) and r = number - s^2.
+         * @throws std::runtime_error if the given BigInteger is negative.
+         */
+        static std::pair<BigInteger, BigInteger> sqrt_rem(const BigInteger &number) {
             if (number.isNegative) {
                 throw std::runtime_error("Square root of a negative number is not defined.");
             }
+            if (number.limbs.empty()) {
+                return {zero(), zero()};
+            }
+
+            BigInteger s;
+            BigInteger r;
+            _sqrtRem(number, (number.bit_length() + 1) / 2, s, r);
+            return {std::move(s), std::move(r)};
+        }
 
-            if (number == zero() || number == one()) {
+        /**
+         * Calculates the integer k-th root, truncated toward zero.
+         *
+         * Uses Newton's iteration x' = ((k - 1) * x + number / x^(k - 1)) / k starting above the root, which decreases
+         * monotonically to the floor of the root. Every step is one power and one division on the fast paths. Large
+         * roots start from the root of the leading half of the bits, so each precision level needs only a few steps.
+         *
+         * @param number The radicand; may be negative for odd k.
+         * @param k The degree of the root, at least 1.
+         * @return The k-th root of number, truncated toward zero.
+         * @throws std::invalid_argument if k is zero.
+         * @throws std::runtime_error if k is even and the number is negative.
+         */
+        static BigInteger nth_root(const BigInteger &number, unsigned int k) {
+            if (k == 0) {
+                throw std::invalid_argument("The degree of a root must be positive.");
+            }
+            if (number.isNegative) {
+                if (k % 2 == 0) {
+                    throw std::runtime_error("Even root of a negative number is not defined.");
+                }
+                return -nth_root(-number, k);
+            }
+            if (k == 1 || number.limbs.empty()) {
                 return number;
             }
+            if (k == 2) {
+                return sqrt(number);
+            }
 
-            BigInteger low = one();
-            BigInteger high = number;
-            BigInteger prev;
+            const std::size_t bits = number.bit_length();
+            if (k >= bits) {
+                return one(); // 1 <= number < 2^k
+            }
 
-            while (low <= high) {
-                BigInteger mid = (low + high) / two();
-                BigInteger square = mid * mid;
+            // Start above the root: from the root of the leading half of the bits when the root is large, which
+            // leaves only a couple of full-size Newton steps, and from a power of two otherwise
+            BigInteger x;
+            const std::size_t rootBits = (bits + k - 1) / k;
+            if (rootBits > 2 * LIMB_BITS) {
+                const std::size_t dropped = rootBits / 2;
+                x = (nth_root(number >> (dropped * k), k) + one()) << dropped;
+            } else {
+                x = one() << rootBits; // x^k >= 2^bits > number
+            }
 
-                if (square == number) {
-                    return mid;
-                } else if (square < number) {
-                    low = mid + one();
-                    prev = mid;
-                } else {
-                    high = mid - one();
+            const BigInteger degree = from_integer(k);
+            const BigInteger degreeMinusOne = from_integer(k - 1);
+            while (true) {
+                BigInteger next = (degreeMinusOne * x + number / pow(x, k - 1)) / degree;
+                if (next >= x) {
+                    return x;
                 }
+                x = std::move(next);
             }
-
-            return prev;
         }
 
+        /**
+         * Determines whether the number is a perfect power a^k with integers a and k >= 2. 0, 1 and -1 count as perfect
+         * powers; a negative number qualifies when it is an odd power.
+         *
+         * Only prime exponents need to be tried, and only up to the smallest-root bound: the root of an odd number is at
+         * least 3, while every exponent of an even number must divide its count of trailing zero bits. Exponents whose
+         * root is below 2^PERFECT_POWER_SMALL_ROOT_BITS are settled by rounding the floating-point root and checking
+         * the candidates against residues of the number modulo a few word-size primes, computed once. Larger roots must
+         * first pass a k-th power residue test modulo small primes p = 1 (mod k) before the exact root is computed.
+         *
+         * @param number The BigInteger to test.
+         * @return True if the number is a perfect power, false otherwise.
+         * @throws std::length_error if the number is so large (about 1.7 * 10^9 bits) that its exponent bound exceeds
+         *         the limit of the prime sieve.
+         */
+        static bool is_perfect_power(const BigInteger &number) {
+            const BigInteger magnitude = number.abs();
+            if (magnitude <= one()) {
+                return true;
+            }
+
+            std::size_t trailingZeros = 0;
+            while (magnitude.limbs[trailingZeros / LIMB_BITS] == 0) {
+                trailingZeros += LIMB_BITS;
+            }
+            trailingZeros += static_cast<std::size_t>(std::countr_zero(magnitude.limbs[trailingZeros / LIMB_BITS]));
+
+            // 3^k <= magnitude < 2^bits for odd numbers; k divides trailingZeros < bits for even ones
+            const std::size_t bits = magnitude.bit_length();
+            const std::size_t maxExponent = trailingZeros != 0
+                                                ? trailingZeros
+                                                : static_cast<std::size_t>(static_cast<double>(bits) / 1.5849625007211562);
+            if (maxExponent < 2) {
+                return false;
+            }
+
+            constexpr std::array<Limb, 4> moduli = {4294967291u, 4294967279u, 4294967231u, 4294967197u};
+            std::array<std::uint64_t, moduli.size()> residues{};
+            for (std::size_t i = 0; i < moduli.size(); ++i) {
+                residues[i] = _remainderSmall(magnitude.limbs.data(), magnitude.limbs.size(), moduli[i]);
+            }
+            const auto [mantissa, exponent] = magnitude.frexp();
+            const double log2Magnitude = std::log2(mantissa) + static_cast<double>(exponent);
+
+            for (int prime: _primesUpTo(maxExponent)) {
+                const auto k = static_cast<std::uint64_t>(prime);
+                if ((number.isNegative && k == 2) || trailingZeros % k != 0) {
+                    continue;
+                }
+
+                const double rootBits = log2Magnitude / static_cast<double>(k);
+                if (rootBits < PERFECT_POWER_SMALL_ROOT_BITS) {
+                    // The estimate is within a small fraction of one of the true root, if there is one
+                    const double estimate = std::exp2(rootBits);
+                    const auto lowest = static_cast<std::uint64_t>(std::max(2.0, std::floor(estimate) - 1));
+                    for (std::uint64_t root = lowest; static_cast<double>(root) <= estimate + 1; ++root) {
+                        bool matches = true;
+                        for (std::size_t i = 0; matches && i < moduli.size(); ++i) {
+                            matches = _powModSmall(root, k, moduli[i]) == residues[i];
+                        }
+                        if (matches && pow(from_integer(root), static_cast<unsigned int>(k)) == magnitude) {
+                            return true;
+                        }
+                    }
+                    continue;
+                }
+
+                // Euler's criterion generalised: a k-th power residue c mod p satisfies c^((p - 1) / k) = 1
+                bool candidate = true;
+                int tests = 0;
+                for (std::uint64_t p = k + 1; tests < 4 && p < std::numeric_limits<Limb>::max(); p += k) {
+                    if (!_isSmallPrime(p)) {
+                        continue;
+                    }
+                    ++tests;
+                    const Limb residue = _remainderSmall(magnitude.limbs.data(), magnitude.limbs.size(),
+                                                         static_cast<Limb>(p));
+                    if (residue != 0 && _powModSmall(residue, (p - 1) / k, p) != 1) {
+                        candidate = false;
+                        break;
+                    }
+                }
+
+                if (candidate) {
+                    const auto degree = static_cast<unsigned int>(k);
+                    if (pow(nth_root(magnitude, degree), degree) == magnitude) {
+                        return true;
+                    }
+                }
+            }
+            return false;
+        }
 
         /**
          * Calculates the base-2 logarithm of a BigInteger.
          *
          * @param number The BigInteger for which to calculate the base-2 logarithm.
-         * @return The base-2 logarithm of the given BigInteger.
+         * @return The floor of the base-2 logarithm of the given BigInteger, read off its bit length.
          * @throws std::out_of_range If the input is zero (log2(0) is undefined) or negative (log2 of a negative number is not allowed).
          */
         static BigInteger log2(const BigInteger &number) {
@@ -861,20 +3710,19 @@ namespace hsc_snippets {
                 throw std::out_of_range("log2(negative) is not allowed");
             }
 
-            BigInteger logVal = BigInteger::from_integer(-1);
-            BigInteger s = number;
-            while (s != BigInteger::zero()) {
-                logVal = logVal + BigInteger::one();
-                s = s / BigInteger::two();
-            }
-            return logVal;
+            return BigInteger::from_integer(number.bit_length() - 1);
         }
 
         /**
          * Calculates the base-10 logarithm of a BigInteger.
          *
+         * The floating-point estimate from `frexp` decides the result in constant time unless it lies within
+         * rounding error of an integer k, as it does for every exact power of ten and its neighbours. Then 10^k is
+         * assembled by `_powerOfTen` from cached powers 10^(9 * 2^j), with up to log2(k / 9) multiplications, and
+         * compared with the number. The decimal digits are never generated.
+         *
          * @param number The BigInteger for which to calculate the base-10 logarithm.
-         * @return An approximation of the base-10 logarithm of the given BigInteger, based on the number of digits.
+         * @return The floor of the base-10 logarithm of the given BigInteger, i.e. its number of digits minus 1.
          * @throws std::out_of_range If the input is zero (log10(0) is undefined) or negative (log10 of a negative number is not allowed).
          */
         static BigInteger log10(const BigInteger &number) {
@@ -885,43 +3733,95 @@ namespace hsc_snippets {
                 throw std::out_of_range("log10(negative) is not allowed");
             }
 
-            // log10 of a number is roughly the number of its digits minus 1
-            return BigInteger::from_integer(number.digits.size() - 1);
+            auto [mantissa, exponent] = number.frexp();
+            const double estimate = std::log10(mantissa) + static_cast<double>(exponent) * 0.30102999566398119521;
+            const double nearest = std::round(estimate);
+            const double tolerance = 1e-9 + static_cast<double>(exponent) * 1e-15;
+            if (std::abs(estimate - nearest) > tolerance) {
+                return BigInteger::from_integer(static_cast<std::int64_t>(std::floor(estimate)));
+            }
+            const auto candidate = static_cast<std::int64_t>(nearest);
+            const bool reached = number >= _powerOfTen(static_cast<std::size_t>(candidate));
+            return BigInteger::from_integer(reached ? candidate : candidate - 1);
+        }
+
+        /**
+         * Calculates the natural logarithm of a BigInteger as a double, from the mantissa and exponent of `frexp`.
+         * Unlike `to_double`, it stays finite for values beyond the range of double.
+         *
+         * @param number The BigInteger for which to calculate the natural logarithm.
+         * @return The natural logarithm of the given BigInteger, accurate to a few units in the last place.
+         * @throws std::out_of_range If the input is zero (log(0) is undefined) or negative (log of a negative number is not allowed).
+         */
+        static double log(const BigInteger &number) {
+            if (number == BigInteger::zero()) {
+                throw std::out_of_range("log(0) is undefined");
+            }
+            if (number.isNegative) {
+                throw std::out_of_range("log(negative) is not allowed");
+            }
+
+            auto [mantissa, exponent] = number.frexp();
+            return std::log(mantissa) + static_cast<double>(exponent) * 0.69314718055994530942;
         }
 
         /**
-         * Multiplies the BigInteger by a power of 10. This operation is optimized for base-10
-         * representations and is performed by simply adding the specified number of zeros to
-         * the least significant digits of the number.
+         * Multiplies the BigInteger by a power of 10. The magnitude is scaled in place by 10^9 per step,
+         * followed by a single smaller power of ten for the remaining exponent. Exponents of at least
+         * POWER_OF_TEN_THRESHOLD digits instead multiply once by 10^power built from the cached powers of ten.
          *
          * @param power The exponent of 10 by which to multiply the BigInteger. For example,
          *              a power of 3 means multiplying the BigInteger by 1000.
          */
         void multiplyByPowerOfTen(std::size_t power) {
-            if (*this == zero()) return; // 0 * 10^n = 0, no need to change anything
-            digits.insert(digits.begin(), power, 0); // Insert 'power' number of zeros at the beginning
-            removeLeadingZeros(); // Just in case there were leading zeros before
+            if (limbs.empty()) return; // 0 * 10^n = 0, no need to change anything
+            if (power >= POWER_OF_TEN_THRESHOLD) {
+                *this *= _powerOfTen(power);
+                return;
+            }
+            while (power > 0) {
+                std::size_t step = std::min<std::size_t>(power, DECIMAL_CHUNK_DIGITS);
+                Limb scale = 1;
+                for (std::size_t i = 0; i < step; ++i) {
+                    scale *= 10;
+                }
+                Limb carry = _multiplyAddSmall(limbs.data(), limbs.size(), scale, 0);
+                if (carry != 0) {
+                    limbs.push_back(carry);
+                }
+                power -= step;
+            }
         }
 
         /**
-         * Divides the BigInteger by a power of 10. This operation is optimized for base-10
-         * representations and is performed by removing the specified number of least significant
-         * digits from the number. If the power exceeds the number of digits, the result is set to 0.
+         * Divides the BigInteger by a power of 10, truncating toward zero. The magnitude is divided in place
+         * by 10^9 per step, or by a single division with the cached 10^power once the exponent reaches
+         * POWER_OF_TEN_THRESHOLD digits. If the power exceeds the number of digits, the result is set to 0.
          *
          * @param power The exponent of 10 by which to divide the BigInteger. For example,
          *              a power of 2 means dividing the BigInteger by 100.
          */
         void divideByPowerOfTen(std::size_t power) {
-            if (power >= digits.size()) {
-                // If power is greater than or equal to the number of digits, the result is 0
-                digits.clear();
-                digits.push_back(0);
-                isNegative = false; // Zero is not negative
-            } else {
-                // Erase 'power' number of digits from the beginning
-                digits.erase(digits.begin(), digits.begin() + static_cast<int>(power));
+            if (limbs.empty()) return;
+            if (power >= POWER_OF_TEN_THRESHOLD) {
+                // 10^power > 2^(3 * power) exceeds the magnitude, so the quotient is zero
+                if (power / 3 >= bit_length()) {
+                    *this = BigInteger(limbs.resource());
+                    return;
+                }
+                *this /= _powerOfTen(power);
+                return;
+            }
+            while (power > 0 && !limbs.empty()) {
+                std::size_t step = std::min<std::size_t>(power, DECIMAL_CHUNK_DIGITS);
+                Limb scale = 1;
+                for (std::size_t i = 0; i < step; ++i) {
+                    scale *= 10;
+                }
+                _divideSmall(limbs.data(), limbs.size(), scale);
+                removeLeadingZeros(); // Also resets the sign once the value drops to zero
+                power -= step;
             }
-            removeLeadingZeros(); // Just in case leading zeros are created
         }
     };
 }
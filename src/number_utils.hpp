@@ -6,6 +6,7 @@
 #include <vector>
 #include <array>
 #include <cstdint>
+#include <algorithm>
 
 namespace hsc_snippets {
 	/**
@@ -53,7 +54,7 @@ namespace hsc_snippets {
 	 * @param n The upper limit (inclusive) up to which prime numbers are to be found.
 	 * @return A std::vector<int> containing all the prime numbers less than or equal to n.
 	 */
-	static std::vector<int> SieveOfEratosthenes(int n) {
+	inline std::vector<int> SieveOfEratosthenes(int n) {
 		// Initialize a boolean vector "prime" with entries up to n. All entries are initially set to true.
 		// A value in prime[i] will be false if i is not a prime number, and true if it is a prime number.
 		std::vector<bool> prime(n + 1, true);
@@ -94,7 +95,7 @@ namespace hsc_snippets {
 	 * @param num The number to check if it is a perfect square.
 	 * @return True if num is a perfect square, otherwise false.
 	 */
-	static bool isPerfectSquare(std::int32_t num) {
+	inline bool isPerfectSquare(std::int32_t num) {
 		if (num < 0) {
 			return false;
 		}
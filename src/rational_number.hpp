@@ -5,16 +5,67 @@
 #include <stdexcept>
 #include <utility>
 #include <string>
+#include <memory_resource>
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <optional>
+#include <limits>
+#include <compare>
+#include <cmath>
+#include <ranges>
+#include <vector>
+
+// Fractions whose parts fit in 64 bits are added, multiplied and compared in 128-bit integer arithmetic where the
+// compiler provides it; elsewhere every operation takes the BigInteger path.
+#if defined(__SIZEOF_INT128__)
+#define HSC_RATIONAL_NUMBER_INT128 1
+#else
+#define HSC_RATIONAL_NUMBER_INT128 0
+#endif
 
 namespace hsc_snippets {
+    /**
+     * @class RationalNumber
+     * @brief Exact fractions nominator/denominator of BigIntegers, kept with a positive denominator.
+     *
+     * Values are reduced to lowest terms after every operation unless lazy normalization is switched on with
+     * `set_lazy`, in which case reduction is deferred until the value is observed.
+     *
+     * Thread safety: like the standard containers, distinct objects may be used from different threads, and a value
+     * in the default eager mode may be read concurrently through its const members. A lazy value that is not
+     * normalized is the exception: its const observers (`to_string`, `==`, `getNominator`, `getDenominator`) reduce
+     * it in place, so concurrent reads race. Call `normalize()` (or `set_lazy(false)`) before sharing a lazy value
+     * between threads; `is_normalized()` tells whether that is still needed.
+     */
     class RationalNumber {
     private:
-        BigInteger nominator;
-        BigInteger denominator;
+        // Mutable so that observers of a lazily normalized number can reduce it in place; see the thread safety note
+        // in the class comment
+        mutable BigInteger nominator;
+        mutable BigInteger denominator;
+        bool lazy = false;
+        // Whether the fraction is known to be in lowest terms, and its size in bits when it last was
+        mutable bool reduced = true;
+        mutable std::size_t reducedBits = 0;
+
+        /**
+         * Size (in bits of numerator plus denominator) a lazy number may grow to without being reduced. Past it, a
+         * result is reduced once it is twice as large as at its last reduction, which keeps the cost of the gcd
+         * amortized against the arithmetic that grew it.
+         */
+        static constexpr std::size_t LAZY_REDUCTION_BITS = 2048;
 
         // Private Constructor
         RationalNumber(BigInteger nominator, BigInteger denominator)
-            : nominator(std::move(nominator)), denominator(std::move(denominator)) {
+            : RationalNumber(std::move(nominator), std::move(denominator), false, false, 0) {
+            reduce();
+        }
+
+        // Builds nominator/denominator with a positive denominator, taking the normalization state as given
+        RationalNumber(BigInteger nominator, BigInteger denominator, bool lazy, bool reduced, std::size_t reducedBits)
+            : nominator(std::move(nominator)), denominator(std::move(denominator)), lazy(lazy), reduced(reduced),
+              reducedBits(reducedBits) {
             if (this->denominator == BigInteger::zero()) {
                 throw std::invalid_argument("Denominator cannot be zero.");
             }
@@ -23,18 +74,267 @@ namespace hsc_snippets {
                 this->nominator = -this->nominator;
                 this->denominator = -this->denominator;
             }
-            reduce();
         }
 
-        void reduce() {
+        [[nodiscard]] std::size_t sizeBits() const {
+            return nominator.bit_length() + denominator.bit_length();
+        }
+
+        void reduce() const {
             BigInteger gcd_value = BigInteger::gcd(nominator, denominator);
-            nominator /= gcd_value;
-            denominator /= gcd_value;
+            if (gcd_value != BigInteger::one()) {
+                nominator /= gcd_value;
+                denominator /= gcd_value;
+            }
             // Ensure denominator is positive
             if (denominator < BigInteger::zero()) {
                 nominator = -nominator;
                 denominator = -denominator;
             }
+            reduced = true;
+            reducedBits = sizeBits();
+        }
+
+        // Reduces a lazily normalized number before its representation is observed
+        void ensureReduced() const {
+            if (!reduced) {
+                reduce();
+            }
+        }
+
+        // Reduces an unreduced fraction right away in eager mode and once it crosses the size threshold in lazy mode
+        void reduceIfDue() const {
+            if (!reduced && (!lazy || sizeBits() > std::max(LAZY_REDUCTION_BITS, 2 * reducedBits))) {
+                reduce();
+            }
+        }
+
+        // Builds a result of arithmetic on a and b, which is lazy if either operand is
+        static RationalNumber result(BigInteger nominator, BigInteger denominator, const RationalNumber &a,
+                                     const RationalNumber &b, bool reduced) {
+            RationalNumber value(std::move(nominator), std::move(denominator), a.lazy || b.lazy, reduced,
+                                 std::max(a.reducedBits, b.reducedBits));
+            value.reduceIfDue();
+            return value;
+        }
+
+        /**
+         * Multiplies (n1 / d1) by (n2 / d2) with cross-cancellation: the gcds of n1 with d2 and of n2 with d1 are
+         * divided out before multiplying, so the factors stay small and the product of two reduced fractions is
+         * reduced without a gcd of the full result.
+         */
+        static RationalNumber crossMultiply(const BigInteger &n1, const BigInteger &d1, const BigInteger &n2,
+                                           const BigInteger &d2, const RationalNumber &a, const RationalNumber &b) {
+            const BigInteger g1 = BigInteger::gcd(n1, d2);
+            const BigInteger g2 = BigInteger::gcd(n2, d1);
+            const bool cancel1 = g1 != BigInteger::one();
+            const bool cancel2 = g2 != BigInteger::one();
+            // The left factors are copied into the resource of their source, which the products inherit
+            BigInteger n = (cancel1 ? n1 / g1 : BigInteger(n1, n1.resource())) * (cancel2 ? n2 / g2 : n2);
+            BigInteger d = (cancel2 ? d1 / g2 : BigInteger(d1, d1.resource())) * (cancel1 ? d2 / g1 : d2);
+            return result(std::move(n), std::move(d), a, b, a.reduced && b.reduced);
+        }
+
+#if HSC_RATIONAL_NUMBER_INT128
+        __extension__ typedef __int128 Wide;
+        __extension__ typedef unsigned __int128 UnsignedWide;
+
+        // The value as int64 if it fits with a magnitude below 2^63, so that negating it cannot overflow
+        static std::optional<std::int64_t> smallPart(const BigInteger &value) {
+            std::optional<std::int64_t> part = value.to<std::int64_t>();
+            if (part && *part == std::numeric_limits<std::int64_t>::min()) {
+                return std::nullopt;
+            }
+            return part;
+        }
+
+        // Numerator and denominator as int64 if the fraction is reduced and both parts are small
+        [[nodiscard]] bool smallParts(std::int64_t &n, std::int64_t &d) const {
+            if (!reduced) {
+                return false;
+            }
+            std::optional<std::int64_t> smallNominator = smallPart(nominator);
+            if (!smallNominator) {
+                return false;
+            }
+            std::optional<std::int64_t> smallDenominator = smallPart(denominator);
+            if (!smallDenominator) {
+                return false;
+            }
+            n = *smallNominator;
+            d = *smallDenominator;
+            return true;
+        }
+
+        static std::uint64_t magnitude(std::int64_t value) {
+            return static_cast<std::uint64_t>(value < 0 ? -value : value);
+        }
+
+        // Converts a 128-bit value of magnitude below 2^127 to a BigInteger allocated from the given resource
+        static BigInteger fromWide(Wide value, std::pmr::memory_resource *resource) {
+            if (value >= std::numeric_limits<std::int64_t>::min() && value <= std::numeric_limits<std::int64_t>::max()) {
+                return BigInteger::from_integer(static_cast<std::int64_t>(value), resource);
+            }
+            const bool negative = value < 0;
+            const auto wideMagnitude = static_cast<UnsignedWide>(negative ? -value : value);
+            BigInteger result = BigInteger::from_integer(static_cast<std::uint64_t>(wideMagnitude >> 64), resource) << 64;
+            result += BigInteger::from_integer(static_cast<std::uint64_t>(wideMagnitude), resource);
+            return negative ? -result : result;
+        }
+
+        // Builds a result of arithmetic on a and b from a reduced 128-bit fraction with positive denominator
+        static RationalNumber smallResult(Wide n, Wide d, const RationalNumber &a, const RationalNumber &b) {
+            std::pmr::memory_resource *resource = a.resource();
+            return {fromWide(n, resource), fromWide(d, resource), a.lazy || b.lazy, true,
+                    std::max(a.reducedBits, b.reducedBits)};
+        }
+
+        /**
+         * n1/d1 + n2/d2 for reduced small fractions, with Knuth's reduction: only gcd(d1, d2) and the gcd of the
+         * cross sum with it are needed, and both fit in 64 bits. Every intermediate stays below 2^127.
+         */
+        static RationalNumber smallSum(std::int64_t n1, std::int64_t d1, std::int64_t n2, std::int64_t d2,
+                                       const RationalNumber &a, const RationalNumber &b) {
+            const auto g = static_cast<std::int64_t>(std::gcd<std::uint64_t, std::uint64_t>(d1, d2));
+            const Wide t = static_cast<Wide>(n1) * (d2 / g) + static_cast<Wide>(n2) * (d1 / g);
+            const auto tModG = static_cast<std::uint64_t>(t < 0 ? -(t % g) : t % g);
+            const auto g2 = static_cast<std::int64_t>(std::gcd<std::uint64_t, std::uint64_t>(tModG, g));
+            return smallResult(t / g2, static_cast<Wide>(d1 / g) * (d2 / g2), a, b);
+        }
+
+        // n1/d1 * n2/d2 for reduced small fractions with cross-cancellation; d2 may be negative
+        static RationalNumber smallProduct(std::int64_t n1, std::int64_t d1, std::int64_t n2, std::int64_t d2,
+                                           const RationalNumber &a, const RationalNumber &b) {
+            if (d2 < 0) {
+                n2 = -n2;
+                d2 = -d2;
+            }
+            const auto g1 = static_cast<std::int64_t>(std::gcd(magnitude(n1), magnitude(d2)));
+            const auto g2 = static_cast<std::int64_t>(std::gcd(magnitude(n2), magnitude(d1)));
+            return smallResult(static_cast<Wide>(n1 / g1) * (n2 / g2), static_cast<Wide>(d1 / g2) * (d2 / g1), a, b);
+        }
+#endif
+
+        // n/d with positive d, left unreduced in either mode for the caller to reduce later
+        static RationalNumber unreduced(BigInteger n, BigInteger d, const RationalNumber &a, const RationalNumber &b) {
+            return {std::move(n), std::move(d), a.lazy || b.lazy, false, 0};
+        }
+
+        // a + b without the final gcd; terms over the same denominator are added directly
+        static RationalNumber sumUnreduced(const RationalNumber &a, const RationalNumber &b) {
+#if HSC_RATIONAL_NUMBER_INT128
+            std::int64_t n1, d1, n2, d2;
+            if (a.smallParts(n1, d1) && b.smallParts(n2, d2)) {
+                return smallSum(n1, d1, n2, d2, a, b);
+            }
+#endif
+            if (a.denominator == b.denominator) {
+                return unreduced(a.nominator + b.nominator, BigInteger(a.denominator, a.resource()), a, b);
+            }
+            BigInteger n = a.nominator * b.denominator;
+            n.addmul(b.nominator, a.denominator);
+            return unreduced(std::move(n), a.denominator * b.denominator, a, b);
+        }
+
+        // a * b without cross-cancellation
+        static RationalNumber productUnreduced(const RationalNumber &a, const RationalNumber &b) {
+#if HSC_RATIONAL_NUMBER_INT128
+            std::int64_t n1, d1, n2, d2;
+            if (a.smallParts(n1, d1) && b.smallParts(n2, d2)) {
+                return smallProduct(n1, d1, n2, d2, a, b);
+            }
+#endif
+            return unreduced(a.nominator * b.nominator, a.denominator * b.denominator, a, b);
+        }
+
+        /**
+         * Folds the values with `combine` over a balanced binary tree and reduces the result once. levels[i] holds
+         * the combination of 2^i consecutive inputs, like the digits of a binary counter, so each input is read once
+         * and only O(log n) partial results are alive at a time. Returns `identity` for an empty range.
+         */
+        template<typename Range, typename Combine>
+        static RationalNumber balancedFold(Range &&values, const RationalNumber &identity, Combine combine) {
+            std::vector<std::optional<RationalNumber>> levels;
+            for (const RationalNumber &value: values) {
+                RationalNumber carry = value;
+                std::size_t level = 0;
+                for (; level < levels.size() && levels[level]; ++level) {
+                    carry = combine(*levels[level], carry);
+                    levels[level].reset();
+                }
+                if (level == levels.size()) {
+                    levels.emplace_back();
+                }
+                levels[level] = std::move(carry);
+            }
+
+            std::optional<RationalNumber> result;
+            for (std::optional<RationalNumber> &partial: levels) {
+                if (partial) {
+                    result = result ? combine(*partial, *result) : std::move(*partial);
+                }
+            }
+            if (!result) {
+                return identity;
+            }
+            result->ensureReduced();
+            return std::move(*result);
+        }
+
+        /**
+         * Three-way comparison of the values, trying cheaper tests before the exact one: the signs, then the bit
+         * lengths (|n / d| lies in (2^(s - 1), 2^(s + 1)) for s = bits(n) - bits(d)), then a double-precision estimate
+         * of the two quotients. Only values that agree to about 14 significant digits are compared exactly by
+         * cross-multiplying, so the common case allocates nothing. Works on unreduced lazy values as well.
+         */
+        [[nodiscard]] int compare(const RationalNumber &other) const {
+#if HSC_RATIONAL_NUMBER_INT128
+            std::int64_t n1, d1, n2, d2;
+            if (smallParts(n1, d1) && other.smallParts(n2, d2)) {
+                const Wide lhs = static_cast<Wide>(n1) * d2;
+                const Wide rhs = static_cast<Wide>(n2) * d1;
+                return lhs < rhs ? -1 : (lhs > rhs ? 1 : 0);
+            }
+#endif
+            // The denominators are positive, so the signs of the numerators decide unless they agree
+            const auto [mantissa1, exponent1] = nominator.frexp();
+            const auto [mantissa2, exponent2] = other.nominator.frexp();
+            const int sign1 = (mantissa1 > 0) - (mantissa1 < 0);
+            const int sign2 = (mantissa2 > 0) - (mantissa2 < 0);
+            if (sign1 != sign2) {
+                return sign1 < sign2 ? -1 : 1;
+            }
+            if (sign1 == 0) {
+                return 0;
+            }
+
+            // Order of the magnitudes, flipped for negative values
+            const auto scale1 = static_cast<std::int64_t>(nominator.bit_length() - denominator.bit_length());
+            const auto scale2 = static_cast<std::int64_t>(other.nominator.bit_length() - other.denominator.bit_length());
+            if (scale1 - scale2 >= 2) {
+                return sign1;
+            }
+            if (scale2 - scale1 >= 2) {
+                return -sign1;
+            }
+
+            const auto [denominatorMantissa1, denominatorExponent1] = denominator.frexp();
+            const auto [denominatorMantissa2, denominatorExponent2] = other.denominator.frexp();
+            const double estimate1 = std::ldexp(std::abs(mantissa1) / denominatorMantissa1,
+                                                static_cast<int>((exponent1 - denominatorExponent1) -
+                                                                 (exponent2 - denominatorExponent2)));
+            const double estimate2 = std::abs(mantissa2) / denominatorMantissa2;
+            // Each estimate carries three roundings of at most 2^-53 relative error
+            if (std::abs(estimate1 - estimate2) > 1e-14 * std::max(estimate1, estimate2)) {
+                return estimate1 > estimate2 ? sign1 : -sign1;
+            }
+
+            if (reduced && other.reduced && nominator == other.nominator && denominator == other.denominator) {
+                return 0;
+            }
+            const BigInteger lhs = nominator * other.denominator;
+            const BigInteger rhs = other.nominator * denominator;
+            return lhs < rhs ? -1 : (lhs > rhs ? 1 : 0);
         }
 
     public:
@@ -60,6 +360,23 @@ namespace hsc_snippets {
             return {std::move(nominator), BigInteger::one()};
         }
 
+        /**
+         * Creates a RationalNumber whose numerator and denominator are allocated from the given memory resource.
+         * Results of arithmetic on it allocate from the same resource, so a batch of rational computations can run
+         * entirely inside an arena such as std::pmr::monotonic_buffer_resource. Copies use the global operator new,
+         * so they may outlive the arena.
+         *
+         * @param nominator The numerator of the rational number.
+         * @param denominator The denominator of the rational number. Must not be zero.
+         * @param resource The memory resource to allocate from, or nullptr for the global operator new.
+         * @return A RationalNumber representing nominator/denominator.
+         * @throws std::invalid_argument if the denominator is zero.
+         */
+        static RationalNumber create(const BigInteger &nominator, const BigInteger &denominator,
+                                     std::pmr::memory_resource *resource) {
+            return {BigInteger(nominator, resource), BigInteger(denominator, resource)};
+        }
+
         /**
          * Returns a reference to a static RationalNumber representing 0/1.
          *
@@ -89,35 +406,85 @@ namespace hsc_snippets {
         // Copy assignment
         RationalNumber &operator=(const RationalNumber &other) = default;
 
-        // Move assignment
-        RationalNumber &operator=(RationalNumber &&other) noexcept = default;
+        // Move assignment; not noexcept, as moving limbs into a target with a different memory resource copies them
+        RationalNumber &operator=(RationalNumber &&other) = default;
 
         // Arithmetic operators
         RationalNumber operator+(const RationalNumber &other) const {
-            BigInteger n = nominator * other.denominator + other.nominator * denominator;
+#if HSC_RATIONAL_NUMBER_INT128
+            std::int64_t n1, d1, n2, d2;
+            if (smallParts(n1, d1) && other.smallParts(n2, d2)) {
+                return smallSum(n1, d1, n2, d2, *this, other);
+            }
+#endif
+            // The cross products are summed in the buffer of the first one
+            BigInteger n = nominator * other.denominator;
+            n.addmul(other.nominator, denominator);
             BigInteger d = denominator * other.denominator;
-            return {n, d};
+            return result(std::move(n), std::move(d), *this, other, false);
         }
 
         RationalNumber operator-(const RationalNumber &other) const {
-            BigInteger n = nominator * other.denominator - other.nominator * denominator;
+#if HSC_RATIONAL_NUMBER_INT128
+            std::int64_t n1, d1, n2, d2;
+            if (smallParts(n1, d1) && other.smallParts(n2, d2)) {
+                return smallSum(n1, d1, -n2, d2, *this, other);
+            }
+#endif
+            BigInteger n = nominator * other.denominator;
+            n.submul(other.nominator, denominator);
             BigInteger d = denominator * other.denominator;
-            return {n, d};
+            return result(std::move(n), std::move(d), *this, other, false);
         }
 
         RationalNumber operator*(const RationalNumber &other) const {
-            BigInteger n = nominator * other.nominator;
-            BigInteger d = denominator * other.denominator;
-            return {n, d};
+#if HSC_RATIONAL_NUMBER_INT128
+            std::int64_t n1, d1, n2, d2;
+            if (smallParts(n1, d1) && other.smallParts(n2, d2)) {
+                return smallProduct(n1, d1, n2, d2, *this, other);
+            }
+#endif
+            return crossMultiply(nominator, denominator, other.nominator, other.denominator, *this, other);
         }
 
         RationalNumber operator/(const RationalNumber &other) const {
             if (other.nominator == BigInteger::zero()) {
                 throw std::invalid_argument("Division by zero.");
             }
-            BigInteger n = nominator * other.denominator;
-            BigInteger d = denominator * other.nominator;
-            return {n, d};
+#if HSC_RATIONAL_NUMBER_INT128
+            std::int64_t n1, d1, n2, d2;
+            if (smallParts(n1, d1) && other.smallParts(n2, d2)) {
+                return smallProduct(n1, d1, d2, n2, *this, other);
+            }
+#endif
+            return crossMultiply(nominator, denominator, other.denominator, other.nominator, *this, other);
+        }
+
+        /**
+         * Sums a range of rational numbers over a balanced tree of additions. Partial sums skip the gcd reduction
+         * (terms over a common denominator are added without multiplying denominators), and only the total is
+         * reduced, so the sizes of the operands stay balanced instead of one accumulator growing term by term.
+         *
+         * @param values A range whose elements convert to const RationalNumber&.
+         * @return The sum of the values in lowest terms, or zero for an empty range.
+         */
+        template<std::ranges::input_range Range>
+            requires std::convertible_to<std::ranges::range_reference_t<Range>, const RationalNumber &>
+        static RationalNumber sum(Range &&values) {
+            return balancedFold(std::forward<Range>(values), zero(), sumUnreduced);
+        }
+
+        /**
+         * Multiplies a range of rational numbers over a balanced tree of multiplications, reducing only the final
+         * product.
+         *
+         * @param values A range whose elements convert to const RationalNumber&.
+         * @return The product of the values in lowest terms, or one for an empty range.
+         */
+        template<std::ranges::input_range Range>
+            requires std::convertible_to<std::ranges::range_reference_t<Range>, const RationalNumber &>
+        static RationalNumber product(Range &&values) {
+            return balancedFold(std::forward<Range>(values), one(), productUnreduced);
         }
 
         // Compound assignment operators
@@ -143,7 +510,7 @@ namespace hsc_snippets {
 
         // Unary minus operator
         RationalNumber operator-() const {
-            return {-nominator, denominator};
+            return {-nominator, BigInteger(denominator, resource()), lazy, reduced, reducedBits};
         }
 
         /**
@@ -154,26 +521,29 @@ namespace hsc_snippets {
             if (nominator == BigInteger::zero()) {
                 throw std::invalid_argument("Cannot invert a zero rational number.");
             }
-            return {denominator, nominator};
+            return {BigInteger(denominator, resource()), BigInteger(nominator, resource()), lazy, reduced, reducedBits};
         }
 
         // Negation function
         [[nodiscard]] RationalNumber negate() const {
-            return {-nominator, denominator};
+            return -*this;
         }
 
         // Absolute value function
         [[nodiscard]] RationalNumber abs() const {
-            return {nominator.abs(), denominator.abs()};
+            return {nominator.abs(), BigInteger(denominator, resource()), lazy, reduced, reducedBits};
         }
 
         // Convert to string representation
         [[nodiscard]] std::string to_string() const {
+            ensureReduced();
             return nominator.to_string() + "/" + denominator.to_string();
         }
 
         // Comparison operators
         bool operator==(const RationalNumber &other) const {
+            ensureReduced();
+            other.ensureReduced();
             return nominator == other.nominator && denominator == other.denominator;
         }
 
@@ -181,28 +551,73 @@ namespace hsc_snippets {
             return !(*this == other);
         }
 
+        std::strong_ordering operator<=>(const RationalNumber &other) const {
+            return compare(other) <=> 0;
+        }
+
         bool operator<(const RationalNumber &other) const {
-            return nominator * other.denominator < other.nominator * denominator;
+            return compare(other) < 0;
         }
 
         bool operator<=(const RationalNumber &other) const {
-            return nominator * other.denominator <= other.nominator * denominator;
+            return compare(other) <= 0;
         }
 
         bool operator>(const RationalNumber &other) const {
-            return nominator * other.denominator > other.nominator * denominator;
+            return compare(other) > 0;
         }
 
         bool operator>=(const RationalNumber &other) const {
-            return nominator * other.denominator >= other.nominator * denominator;
+            return compare(other) >= 0;
+        }
+
+        // The memory resource the numerator and denominator are allocated from
+        [[nodiscard]] std::pmr::memory_resource *resource() const {
+            return nominator.resource();
+        }
+
+        /**
+         * Switches lazy normalization on or off. A lazy number skips the gcd reduction after `+` and `-` and reduces
+         * only when it is observed (`to_string`, `==`, the getters), by `normalize`, or when it has grown to twice
+         * its size at the last reduction. Results of arithmetic are lazy if either operand is, so a long accumulation
+         * chain only needs its first value marked. Switching lazy mode off reduces the number.
+         *
+         * Thread safety: observing a lazy number that is not normalized reduces it in place, even through a const
+         * reference, so such a number must not be read from several threads at once. Call `normalize()` before
+         * sharing it; results stay normalized until they are changed again.
+         *
+         * @param enabled Whether results of arithmetic on this number defer their reduction.
+         * @return A reference to this number.
+         */
+        RationalNumber &set_lazy(bool enabled) {
+            lazy = enabled;
+            if (!enabled) {
+                ensureReduced();
+            }
+            return *this;
+        }
+
+        [[nodiscard]] bool is_lazy() const {
+            return lazy;
+        }
+
+        // Reduces the fraction to lowest terms now, e.g. at the end of a lazy accumulation chain
+        void normalize() {
+            ensureReduced();
+        }
+
+        [[nodiscard]] bool is_normalized() const {
+            return reduced;
         }
 
         // Getter functions
         [[nodiscard]] const BigInteger &getNominator() const {
+            ensureReduced();
             return nominator;
         }
 
         [[nodiscard]] const BigInteger &getDenominator() const {
+            ensureReduced();
             return denominator;
         }
     };
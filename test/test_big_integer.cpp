@@ -2,6 +2,12 @@
 #include "big_integer.hpp"
 #include <random>
 #include <iostream>
+#include <bit>
+#include <memory_resource>
+#include <optional>
+#include <cmath>
+#include <cstdlib>
+#include <thread>
 
 using namespace hsc_snippets;
 
@@ -902,6 +908,26 @@ TEST_CASE("BigInteger::log10 method", "[log10]") {
     }
 }
 
+TEST_CASE("BigInteger::log method", "[log]") {
+    SECTION("log of small numbers matches std::log") {
+        for (long long value : {1LL, 2LL, 3LL, 10LL, 12345LL, 4294967296LL, 9007199254740993LL}) {
+            REQUIRE(std::abs(BigInteger::log(BigInteger::from_integer(value)) - std::log(static_cast<double>(value))) < 1e-12);
+        }
+    }
+
+    SECTION("log of numbers beyond double range") {
+        BigInteger power = BigInteger::pow(BigInteger::from_integer(10), 5000);
+        REQUIRE(std::abs(BigInteger::log(power) - 5000 * std::log(10.0)) < 1e-9);
+        REQUIRE(std::abs(BigInteger::log(power * BigInteger::from_integer(3)) - 5000 * std::log(10.0) - std::log(3.0)) < 1e-9);
+        REQUIRE(BigInteger::log2(power << 7).to_string() == std::to_string(power.bit_length() + 6));
+    }
+
+    SECTION("log of zero and negative numbers throws exception") {
+        REQUIRE_THROWS_AS(BigInteger::log(BigInteger::from_integer(0)), std::out_of_range);
+        REQUIRE_THROWS_AS(BigInteger::log(BigInteger::from_integer(-1)), std::out_of_range);
+    }
+}
+
 TEST_CASE("BigInteger multiplication by power of 10", "[multiplyByPowerOfTen]") {
     SECTION("Multiplying non-zero numbers") {
         BigInteger num = BigInteger::parse("123");
@@ -942,4 +968,1222 @@ TEST_CASE("BigInteger division by power of 10", "[divideByPowerOfTen]") {
         num.divideByPowerOfTen(3);
         REQUIRE(num.to_string() == "0");
     }
-}
\ No newline at end of file
+}
+std::string randomDecimalString(std::mt19937 &gen, std::size_t length) {
+    std::uniform_int_distribution<int> digit(0, 9);
+    std::string s(length, '0');
+    for (auto &c: s) {
+        c = static_cast<char>('0' + digit(gen));
+    }
+    s[0] = static_cast<char>('1' + digit(gen) % 9);
+    return s;
+}
+
+TEST_CASE("BigInteger multi-limb values", "[BigInteger][Limbs]") {
+    std::mt19937 gen(std::random_device{}());
+
+    SECTION("Round trip through parse and to_string") {
+        for (std::size_t length = 1; length < 200; length += 7) {
+            std::string s = randomDecimalString(gen, length);
+            REQUIRE(BigInteger::parse(s).to_string() == s);
+            REQUIRE(BigInteger::parse("-" + s).to_string() == "-" + s);
+        }
+        REQUIRE(BigInteger::parse("4294967296").to_string() == "4294967296");
+        REQUIRE(BigInteger::parse("18446744073709551616").to_string() == "18446744073709551616");
+    }
+
+    SECTION("Known values") {
+        REQUIRE(BigInteger::factorial(25).to_string() == "15511210043330985984000000");
+        REQUIRE(BigInteger::pow(BigInteger::two(), 100).to_string() == "1267650600228229401496703205376");
+        REQUIRE((BigInteger::pow(BigInteger::two(), 64) - BigInteger::one()).to<std::uint64_t>() ==
+                std::numeric_limits<std::uint64_t>::max());
+        REQUIRE(!BigInteger::pow(BigInteger::two(), 64).to<std::uint64_t>().has_value());
+        REQUIRE(BigInteger::from_integer(std::numeric_limits<std::int64_t>::min()).to<std::int64_t>() ==
+                std::numeric_limits<std::int64_t>::min());
+    }
+
+    SECTION("Division identities on large operands") {
+        for (int i = 0; i < 50; ++i) {
+            BigInteger a = BigInteger::parse(randomDecimalString(gen, 60 + i));
+            BigInteger b = BigInteger::parse(randomDecimalString(gen, 1 + i));
+            if (i % 2 == 1) {
+                a.negate();
+            }
+            auto [q, r] = a.divmod(b);
+            REQUIRE(q * b + r == a);
+            REQUIRE(r.abs() < b.abs());
+            REQUIRE((a * b) / b == a);
+        }
+    }
+
+    SECTION("Decimal shifts") {
+        BigInteger num = BigInteger::parse("123456789123456789");
+        num.multiplyByPowerOfTen(25);
+        REQUIRE(num.to_string() == "1234567891234567890000000000000000000000000");
+        num.divideByPowerOfTen(30);
+        REQUIRE(num.to_string() == "1234567891234");
+    }
+}
+
+TEST_CASE("BigInteger subquadratic multiplication", "[BigInteger][Multiplication][Karatsuba][Toom3]") {
+    std::mt19937 gen(std::random_device{}());
+    const BigInteger prime = BigInteger::from_integer(1000000007);
+
+    // Digit counts around and above the Karatsuba and Toom-3 thresholds, including unbalanced operands
+    for (std::size_t length: {300, 500, 1200, 3000, 9000}) {
+        for (std::size_t divisor: {1, 2, 5}) {
+            BigInteger a = BigInteger::parse(randomDecimalString(gen, length));
+            BigInteger b = BigInteger::parse(randomDecimalString(gen, length / divisor));
+            BigInteger product = a * b;
+
+            // Cross-check multiplication against squaring: (a + b)^2 - (a - b)^2 == 4ab
+            BigInteger sum = a + b;
+            BigInteger difference = a - b;
+            REQUIRE(sum * sum - difference * difference == product + product + product + product);
+
+            REQUIRE(product % prime == (a % prime) * (b % prime) % prime);
+            REQUIRE((-a) * b == -product);
+        }
+    }
+
+    SECTION("pow squares large bases") {
+        BigInteger base = BigInteger::parse(randomDecimalString(gen, 2000));
+        REQUIRE(BigInteger::pow(base, 3) == base * base * base);
+    }
+}
+
+TEST_CASE("BigInteger NTT multiplication", "[BigInteger][Multiplication][NTT]") {
+    std::mt19937 gen(std::random_device{}());
+    const BigInteger prime = BigInteger::from_integer(998244353);
+
+    // Around 4000 limbs and above, where operator* switches to the number theoretic transform
+    for (std::size_t length: {40000, 100000}) {
+        BigInteger a = BigInteger::parse(randomDecimalString(gen, length));
+        BigInteger b = BigInteger::parse(randomDecimalString(gen, length - 1000));
+        BigInteger product = a * b;
+
+        BigInteger sum = a + b;
+        BigInteger difference = a - b;
+        REQUIRE(sum * sum - difference * difference == product + product + product + product);
+        REQUIRE(product % prime == (a % prime) * (b % prime) % prime);
+    }
+
+    SECTION("Carries across all pieces") {
+        // (2^k - 1)^2 = 2^2k - 2^(k+1) + 1 exercises maximal convolution coefficients
+        BigInteger ones = BigInteger::pow(BigInteger::two(), 32 * 5000) - BigInteger::one();
+        BigInteger expected = BigInteger::pow(BigInteger::two(), 64 * 5000) -
+                              BigInteger::pow(BigInteger::two(), 32 * 5000 + 1) + BigInteger::one();
+        REQUIRE(ones * ones == expected);
+    }
+}
+
+BigInteger randomLimbPattern(std::mt19937 &gen, int limbs) {
+    // Mixes random limbs with all-zero, all-one and top-bit limbs that stress quotient digit estimation
+    const std::uint32_t special[] = {0, 1, 0xFFFFFFFFu, 0x80000000u, 0x7FFFFFFFu};
+    const BigInteger base = BigInteger::from_integer(std::uint64_t{1} << 32);
+    BigInteger result = BigInteger::zero();
+    for (int i = 0; i < limbs; ++i) {
+        std::uint32_t limb = gen() % 3 == 0 ? static_cast<std::uint32_t>(gen()) : special[gen() % 5];
+        result = result * base + BigInteger::from_integer(limb);
+    }
+    return result;
+}
+
+TEST_CASE("BigInteger long division", "[BigInteger][Division][Knuth][Newton]") {
+    std::mt19937 gen(std::random_device{}());
+
+    SECTION("Algorithm D on adversarial limb patterns") {
+        for (int i = 0; i < 5000; ++i) {
+            BigInteger a = randomLimbPattern(gen, 1 + static_cast<int>(gen() % 12));
+            BigInteger b = randomLimbPattern(gen, 1 + static_cast<int>(gen() % 8));
+            if (b == BigInteger::zero()) {
+                continue;
+            }
+            auto [q, r] = a.divmod(b);
+            REQUIRE(q * b + r == a);
+            REQUIRE(r >= BigInteger::zero());
+            REQUIRE(r < b);
+        }
+    }
+
+    SECTION("Newton reciprocal division on huge operands") {
+        BigInteger b = BigInteger::parse(randomDecimalString(gen, 80000));
+        BigInteger a = BigInteger::parse(randomDecimalString(gen, 170000));
+        auto [q, r] = a.divmod(b);
+        REQUIRE(q * b + r == a);
+        REQUIRE(r >= BigInteger::zero());
+        REQUIRE(r < b);
+        REQUIRE(a / b == q);
+        REQUIRE(-a % b == -r);
+    }
+}
+
+TEST_CASE("BigInteger in-place and rvalue arithmetic", "[BigInteger][Operators][InPlace]") {
+    std::mt19937 gen(std::random_device{}());
+    std::uniform_int_distribution<std::int64_t> dist64(std::numeric_limits<std::int64_t>::min() / 4,
+                                                        std::numeric_limits<std::int64_t>::max() / 4);
+
+    SECTION("Compound operators agree with the binary operators") {
+        for (int i = 0; i < 1000; ++i) {
+            BigInteger a = BigInteger::parse(randomDecimalString(gen, 1 + gen() % 40));
+            BigInteger b = BigInteger::parse(randomDecimalString(gen, 1 + gen() % 40));
+            if (gen() % 2) a.negate();
+            if (gen() % 2) b.negate();
+
+            BigInteger sum = a, difference = a, product = a, quotient = a;
+            sum += b;
+            difference -= b;
+            product *= b;
+            quotient /= b;
+            REQUIRE(sum == a + b);
+            REQUIRE(difference == a - b);
+            REQUIRE(product == a * b);
+            REQUIRE(quotient == a / b);
+
+            BigInteger small = BigInteger::from_integer(static_cast<std::int32_t>(gen() % 2000000) - 1000000);
+            BigInteger scaled = a;
+            scaled *= small;
+            REQUIRE(scaled == a * small);
+            if (small != BigInteger::zero()) {
+                BigInteger divided = a;
+                divided /= small;
+                REQUIRE(divided == a / small);
+            }
+        }
+    }
+
+    SECTION("Aliased operands") {
+        BigInteger a = BigInteger::parse("-" + randomDecimalString(gen, 50));
+        BigInteger expected = a + a;
+        BigInteger doubled = a;
+        doubled += doubled;
+        REQUIRE(doubled == expected);
+        doubled -= doubled;
+        REQUIRE(doubled == BigInteger::zero());
+        REQUIRE(doubled.to_string() == "0");
+
+        BigInteger squared = a;
+        squared *= squared;
+        REQUIRE(squared == a * a);
+
+        // The rvalue overloads may reuse the buffer of an operand that is also the other operand
+        BigInteger x = a;
+        BigInteger difference = x - std::move(x);
+        REQUIRE(difference == BigInteger::zero());
+        REQUIRE(difference.to_string() == "0");
+        x = a;
+        REQUIRE(x + std::move(x) == expected);
+        x = a;
+        REQUIRE(std::move(x) - std::move(x) == BigInteger::zero());
+        x = a;
+        REQUIRE(std::move(x) + std::move(x) == expected);
+        x = a;
+        REQUIRE(std::move(x) - x == BigInteger::zero());
+        x = a;
+        REQUIRE(std::move(x) + x == expected);
+    }
+
+    SECTION("Rvalue chains") {
+        for (int i = 0; i < 1000; ++i) {
+            std::int64_t x = dist64(gen), y = dist64(gen), z = dist64(gen);
+            BigInteger a = BigInteger::from_integer(x), b = BigInteger::from_integer(y), c = BigInteger::from_integer(z);
+            REQUIRE((a + b) + c == BigInteger::from_integer(x + y + z));
+            REQUIRE(a + (b - c) == BigInteger::from_integer(x + y - z));
+            REQUIRE(a - (b + c) == BigInteger::from_integer(x - y - z));
+            REQUIRE((a - b) - (c + a) == BigInteger::from_integer(-y - z));
+            REQUIRE((a * b) + (c * a) - (b * c) == a * b + c * a - b * c);
+        }
+    }
+
+    SECTION("Accumulation crosses zero and limb boundaries") {
+        BigInteger total = BigInteger::zero();
+        BigInteger step = BigInteger::from_integer(std::numeric_limits<std::uint32_t>::max());
+        for (int i = 0; i < 100; ++i) {
+            total += step;
+        }
+        REQUIRE(total == step * BigInteger::from_integer(100));
+        for (int i = 0; i < 150; ++i) {
+            total -= step;
+        }
+        REQUIRE(total == -(step * BigInteger::from_integer(50)));
+    }
+}
+
+TEST_CASE("BigInteger small values", "[BigInteger][Inline]") {
+    std::mt19937 gen(606);
+
+    SECTION("Growing past and shrinking below the inline capacity") {
+        BigInteger value = BigInteger::one();
+        BigInteger two32 = BigInteger::from_integer(std::uint64_t{1} << 32);
+        for (int i = 0; i < 8; ++i) {
+            value *= two32;
+        }
+        REQUIRE(value.to_string() == "115792089237316195423570985008687907853269984665640564039457584007913129639936");
+        for (int i = 0; i < 8; ++i) {
+            value /= two32;
+        }
+        REQUIRE(value == BigInteger::one());
+        value -= BigInteger::one();
+        REQUIRE(value == BigInteger::zero());
+        REQUIRE(value.to_string() == "0");
+    }
+
+    SECTION("Copies and moves of inline and heap values") {
+        BigInteger small = BigInteger::from_integer(-123456789012345LL);
+        BigInteger large = BigInteger::parse("-" + randomDecimalString(gen, 100));
+        BigInteger smallCopy = small;
+        BigInteger largeCopy = large;
+        REQUIRE(smallCopy == small);
+        REQUIRE(largeCopy == large);
+
+        BigInteger moved = std::move(largeCopy);
+        REQUIRE(moved == large);
+        moved = small;
+        REQUIRE(moved == small);
+        moved = large;
+        REQUIRE(moved == large);
+        moved = std::move(smallCopy);
+        REQUIRE(moved == small);
+    }
+
+    SECTION("Word-sized addition edge cases") {
+        const std::uint64_t max64 = std::numeric_limits<std::uint64_t>::max();
+        BigInteger max = BigInteger::from_integer(max64);
+        REQUIRE((max + BigInteger::one()).to_string() == "18446744073709551616");
+        REQUIRE((max + max).to_string() == "36893488147419103230");
+        REQUIRE((-max - max).to_string() == "-36893488147419103230");
+        REQUIRE((max - max) == BigInteger::zero());
+        REQUIRE((max - max).to_string() == "0");
+        REQUIRE((-max + max).to_string() == "0");
+        REQUIRE((BigInteger::one() - max).to_string() == "-18446744073709551614");
+        REQUIRE((-BigInteger::one() + max).to_string() == "18446744073709551614");
+
+        std::uniform_int_distribution<std::int64_t> dist(-(1LL << 62), 1LL << 62);
+        for (int i = 0; i < 1000; ++i) {
+            std::int64_t x = dist(gen), y = dist(gen);
+            BigInteger a = BigInteger::from_integer(x), b = BigInteger::from_integer(y);
+            REQUIRE((a + b).to<std::int64_t>() == x + y);
+            REQUIRE((a - b).to<std::int64_t>() == x - y);
+            REQUIRE((b - a).to<std::int64_t>() == y - x);
+        }
+    }
+
+    SECTION("Products that stay inline") {
+        std::uniform_int_distribution<std::uint64_t> dist(0, std::numeric_limits<std::uint64_t>::max());
+        for (int i = 0; i < 1000; ++i) {
+            std::uint64_t x = dist(gen), y = dist(gen);
+            // (xh * 2^32 + xl) * (yh * 2^32 + yl), with every 32 x 32-bit partial product exact in uint64_t
+            const std::uint64_t xh = x >> 32, xl = x & 0xFFFFFFFFu, yh = y >> 32, yl = y & 0xFFFFFFFFu;
+            BigInteger expected = (BigInteger::from_integer(xh * yh) << 64)
+                                  + (BigInteger::from_integer(xh * yl) << 32)
+                                  + (BigInteger::from_integer(xl * yh) << 32)
+                                  + BigInteger::from_integer(xl * yl);
+            REQUIRE(BigInteger::from_integer(x) * BigInteger::from_integer(y) == expected);
+            REQUIRE(BigInteger::from_integer(x) * -BigInteger::from_integer(y) == -expected);
+        }
+    }
+}
+
+TEST_CASE("BigInteger Lehmer and extended gcd", "[BigInteger][gcd]") {
+    std::mt19937 gen(707);
+
+    auto euclid = [](BigInteger x, BigInteger y) {
+        x = x.abs();
+        y = y.abs();
+        while (y != BigInteger::zero()) {
+            BigInteger r = x % y;
+            x = std::move(y);
+            y = std::move(r);
+        }
+        return x;
+    };
+
+    SECTION("Multi-limb operands with a common factor") {
+        for (int digits: {20, 60, 200, 1000}) {
+            for (int i = 0; i < 10; ++i) {
+                BigInteger common = BigInteger::parse(randomDecimalString(gen, digits / 2));
+                BigInteger a = common * BigInteger::parse(randomDecimalString(gen, digits));
+                BigInteger b = common * BigInteger::parse("-" + randomDecimalString(gen, digits + i));
+                BigInteger g = BigInteger::gcd(a, b);
+                REQUIRE(g == euclid(a, b));
+                REQUIRE(a % g == BigInteger::zero());
+                REQUIRE(b % g == BigInteger::zero());
+                REQUIRE(BigInteger::gcd(b, a) == g);
+            }
+        }
+    }
+
+    SECTION("Consecutive Fibonacci numbers are coprime") {
+        BigInteger f0 = BigInteger::zero(), f1 = BigInteger::one();
+        for (int i = 0; i < 2000; ++i) {
+            BigInteger next = f0 + f1;
+            f0 = std::move(f1);
+            f1 = std::move(next);
+        }
+        REQUIRE(BigInteger::gcd(f1, f0) == BigInteger::one());
+        REQUIRE(BigInteger::gcd(f1 * f0, f0 * BigInteger::from_integer(5)) == f0);
+    }
+
+    SECTION("Zero operands") {
+        BigInteger a = BigInteger::parse("-" + randomDecimalString(gen, 40));
+        REQUIRE(BigInteger::gcd(a, BigInteger::zero()) == a.abs());
+        REQUIRE(BigInteger::gcd(BigInteger::zero(), a) == a.abs());
+        REQUIRE(BigInteger::gcd(BigInteger::zero(), BigInteger::zero()) == BigInteger::zero());
+    }
+
+    SECTION("Bezout coefficients") {
+        std::vector<std::pair<BigInteger, BigInteger> > cases = {
+                {BigInteger::zero(), BigInteger::zero()},
+                {BigInteger::from_integer(-7), BigInteger::zero()},
+                {BigInteger::zero(), BigInteger::from_integer(-7)},
+                {BigInteger::from_integer(240), BigInteger::from_integer(46)},
+                {BigInteger::from_integer(-240), BigInteger::from_integer(46)},
+                {BigInteger::from_integer(46), BigInteger::from_integer(-240)},
+        };
+        for (int digits: {15, 50, 300}) {
+            for (int i = 0; i < 5; ++i) {
+                BigInteger common = BigInteger::parse(randomDecimalString(gen, 10));
+                cases.emplace_back(common * BigInteger::parse(randomDecimalString(gen, digits)),
+                                   common * BigInteger::parse("-" + randomDecimalString(gen, digits + 3 * i)));
+            }
+        }
+
+        for (const auto &[a, b]: cases) {
+            auto [g, x, y] = BigInteger::extended_gcd(a, b);
+            REQUIRE(g == BigInteger::gcd(a, b));
+            REQUIRE(a * x + b * y == g);
+            if (a != BigInteger::zero() && b != BigInteger::zero()) {
+                REQUIRE(x.abs() <= b.abs());
+                REQUIRE(y.abs() <= a.abs());
+            }
+        }
+    }
+}
+
+TEST_CASE("BigInteger divide-and-conquer radix conversion", "[BigInteger][parse][to_string]") {
+    std::mt19937 gen(808);
+
+    SECTION("Round trips around the conversion thresholds") {
+        for (std::size_t length: {530, 539, 540, 541, 600, 1000, 4321, 9000, 20000, 100000}) {
+            std::string s = randomDecimalString(gen, length);
+            BigInteger value = BigInteger::parse(s);
+            REQUIRE(value.to_string() == s);
+            REQUIRE((-value).to_string() == "-" + s);
+            REQUIRE(BigInteger::parse("-" + s) == -value);
+        }
+    }
+
+    SECTION("Runs of zeros and nines survive the splits") {
+        for (std::size_t length: {600, 2000, 30000}) {
+            std::string power = "1" + std::string(length, '0');
+            std::string nines(length, '9');
+            std::string sparse = "7" + std::string(length / 2, '0') + "3" + std::string(length / 3, '0') + "1";
+            REQUIRE(BigInteger::parse(power).to_string() == power);
+            REQUIRE(BigInteger::parse(nines).to_string() == nines);
+            REQUIRE(BigInteger::parse(sparse).to_string() == sparse);
+            REQUIRE(BigInteger::parse(nines) + BigInteger::one() == BigInteger::parse(power));
+            REQUIRE(BigInteger::parse(std::string(length, '0') + "42").to_string() == "42");
+        }
+    }
+
+    SECTION("Agrees with scaling by powers of ten") {
+        for (std::size_t length: {1200, 15000}) {
+            std::string head = randomDecimalString(gen, length);
+            std::string tail = randomDecimalString(gen, length / 3);
+            BigInteger expected = BigInteger::parse(head);
+            expected.multiplyByPowerOfTen(tail.size());
+            expected += BigInteger::parse(tail);
+            REQUIRE(BigInteger::parse(head + tail) == expected);
+            REQUIRE(expected.to_string() == head + tail);
+        }
+    }
+}
+
+TEST_CASE("BigInteger bitwise operations", "[BigInteger][Bitwise]") {
+    std::mt19937 gen(909);
+    std::uniform_int_distribution<std::int64_t> dist(-(1LL << 40), 1LL << 40);
+    std::uniform_int_distribution<int> shiftDist(0, 20);
+
+    SECTION("Matches the built-in operators on 64-bit values") {
+        for (int i = 0; i < 2000; ++i) {
+            std::int64_t x = dist(gen), y = dist(gen);
+            int k = shiftDist(gen);
+            BigInteger a = BigInteger::from_integer(x), b = BigInteger::from_integer(y);
+            REQUIRE((a & b).to<std::int64_t>() == (x & y));
+            REQUIRE((a | b).to<std::int64_t>() == (x | y));
+            REQUIRE((a ^ b).to<std::int64_t>() == (x ^ y));
+            REQUIRE((~a).to<std::int64_t>() == ~x);
+            REQUIRE((a << k).to<std::int64_t>() == x * (std::int64_t{1} << k));
+            REQUIRE((a >> k).to<std::int64_t>() == (x >> k));
+            REQUIRE((a >> 100).to<std::int64_t>() == (x < 0 ? -1 : 0));
+            REQUIRE(a.test_bit(k) == (((x >> k) & 1) != 0));
+            REQUIRE(a.test_bit(200) == (x < 0));
+            REQUIRE(a.bit_length() == static_cast<std::size_t>(std::bit_width(static_cast<std::uint64_t>(x < 0 ? -x : x))));
+            REQUIRE(a.popcount() == static_cast<std::size_t>(std::popcount(static_cast<std::uint64_t>(x < 0 ? -x : x))));
+        }
+    }
+
+    SECTION("Multi-limb identities") {
+        for (int i = 0; i < 50; ++i) {
+            BigInteger a = BigInteger::parse((i % 2 ? "-" : "") + randomDecimalString(gen, 30 + i * 3));
+            BigInteger b = BigInteger::parse((i % 3 ? "" : "-") + randomDecimalString(gen, 60 - i));
+            REQUIRE((a & b) + (a | b) == a + b);
+            REQUIRE((a ^ b) == (a | b) - (a & b));
+            REQUIRE((a ^ b ^ b) == a);
+            REQUIRE((a & ~a) == BigInteger::zero());
+            REQUIRE((a | ~a) == -BigInteger::one());
+            REQUIRE(~~a == a);
+
+            std::size_t k = static_cast<std::size_t>(i * 7);
+            BigInteger scale = BigInteger::pow(BigInteger::two(), static_cast<unsigned int>(k));
+            REQUIRE((a << k) == a * scale);
+            REQUIRE(((a << k) >> k) == a);
+            BigInteger floorQuotient = a / scale;
+            if (a < BigInteger::zero() && floorQuotient * scale != a) {
+                --floorQuotient;
+            }
+            REQUIRE((a >> k) == floorQuotient);
+            REQUIRE(a.test_bit(k) == (((a >> k) & BigInteger::one()) == BigInteger::one()));
+        }
+    }
+
+    SECTION("In-place and aliased operands") {
+        BigInteger a = BigInteger::parse("-" + randomDecimalString(gen, 40));
+        BigInteger b = a;
+        b &= b;
+        REQUIRE(b == a);
+        b |= b;
+        REQUIRE(b == a);
+        b ^= b;
+        REQUIRE(b == BigInteger::zero());
+
+        BigInteger c = a;
+        c <<= 65;
+        c >>= 65;
+        REQUIRE(c == a);
+        c >>= 10000;
+        REQUIRE(c == -BigInteger::one());
+    }
+
+    SECTION("Bit length, population count and log2") {
+        BigInteger allOnes = (BigInteger::one() << 200) - BigInteger::one();
+        REQUIRE(allOnes.bit_length() == 200);
+        REQUIRE(allOnes.popcount() == 200);
+        REQUIRE((-allOnes).popcount() == 200);
+        REQUIRE((allOnes + BigInteger::one()).bit_length() == 201);
+        REQUIRE(BigInteger::zero().bit_length() == 0);
+        REQUIRE(BigInteger::log2(allOnes) == BigInteger::from_integer(199));
+        REQUIRE(BigInteger::log2(allOnes + BigInteger::one()) == BigInteger::from_integer(200));
+        REQUIRE((BigInteger::one() << 200).test_bit(200));
+        REQUIRE_FALSE((BigInteger::one() << 200).test_bit(199));
+        REQUIRE((-(BigInteger::one() << 200)).test_bit(200));
+        REQUIRE_FALSE((-(BigInteger::one() << 200)).test_bit(199));
+        REQUIRE((-(BigInteger::one() << 200)).test_bit(201));
+    }
+}
+
+TEST_CASE("BigInteger modular exponentiation", "[BigInteger][pow_mod][Montgomery]") {
+    std::mt19937 gen(1010);
+
+    auto naivePowMod = [](const BigInteger &base, const BigInteger &exponent, const BigInteger &modulus) {
+        BigInteger b = base % modulus;
+        if (b < BigInteger::zero()) {
+            b += modulus;
+        }
+        BigInteger result = BigInteger::one() % modulus;
+        for (std::size_t i = exponent.bit_length(); i-- > 0;) {
+            result = result * result % modulus;
+            if (exponent.test_bit(i)) {
+                result = result * b % modulus;
+            }
+        }
+        return result;
+    };
+
+    SECTION("Small values") {
+        BigInteger m = BigInteger::from_integer(1000000007);
+        REQUIRE(BigInteger::pow_mod(BigInteger::two(), 10, m) == BigInteger::from_integer(1024));
+        REQUIRE(BigInteger::pow_mod(BigInteger::from_integer(3), 1000000006, m) == BigInteger::one());
+        REQUIRE(BigInteger::pow_mod(BigInteger::from_integer(-2), 3, m) == BigInteger::from_integer(1000000007 - 8));
+        REQUIRE(BigInteger::pow_mod(BigInteger::from_integer(5), 0, m) == BigInteger::one());
+        REQUIRE(BigInteger::pow_mod(BigInteger::zero(), 0, m) == BigInteger::one());
+        REQUIRE(BigInteger::pow_mod(BigInteger::from_integer(5), 7, BigInteger::one()) == BigInteger::zero());
+        REQUIRE(BigInteger::pow_mod(BigInteger::from_integer(3), 5, BigInteger::from_integer(16)) == BigInteger::from_integer(3));
+    }
+
+    SECTION("Agrees with square-and-multiply for odd and even moduli") {
+        for (int digits: {5, 20, 80, 320}) {
+            for (int i = 0; i < 6; ++i) {
+                BigInteger modulus = BigInteger::parse(randomDecimalString(gen, digits));
+                BigInteger base = BigInteger::parse((i % 2 ? "-" : "") + randomDecimalString(gen, digits + 5));
+                BigInteger exponent = BigInteger::parse(randomDecimalString(gen, 1 + i * 15));
+                REQUIRE(BigInteger::pow_mod(base, exponent, modulus) == naivePowMod(base, exponent, modulus));
+            }
+        }
+    }
+
+    SECTION("Fermat's little theorem for a Mersenne prime") {
+        BigInteger p = (BigInteger::one() << 127) - BigInteger::one();
+        for (int i = 0; i < 5; ++i) {
+            BigInteger a = BigInteger::parse(randomDecimalString(gen, 30));
+            REQUIRE(BigInteger::pow_mod(a, p - BigInteger::one(), p) == BigInteger::one());
+            REQUIRE(BigInteger::pow_mod(a, p, p) == a % p);
+        }
+    }
+
+    SECTION("Montgomery context") {
+        BigInteger modulus = BigInteger::parse(randomDecimalString(gen, 100) + "1");
+        BigInteger::MontgomeryContext context(modulus);
+        REQUIRE(context.modulus() == modulus);
+        for (int i = 0; i < 20; ++i) {
+            BigInteger a = BigInteger::parse(randomDecimalString(gen, 90));
+            BigInteger b = BigInteger::parse("-" + randomDecimalString(gen, 120));
+            BigInteger am = context.to_montgomery(a);
+            BigInteger bm = context.to_montgomery(b);
+            REQUIRE(am < modulus);
+            REQUIRE(context.from_montgomery(am) == a % modulus);
+            BigInteger expected = a * b % modulus;
+            if (expected < BigInteger::zero()) {
+                expected += modulus;
+            }
+            REQUIRE(context.from_montgomery(context.multiply(am, bm)) == expected);
+            REQUIRE(context.pow(a, BigInteger::from_integer(i)) == naivePowMod(a, BigInteger::from_integer(i), modulus));
+        }
+    }
+
+    SECTION("Invalid arguments") {
+        REQUIRE_THROWS_AS(BigInteger::pow_mod(BigInteger::two(), 3, BigInteger::zero()), std::invalid_argument);
+        REQUIRE_THROWS_AS(BigInteger::pow_mod(BigInteger::two(), 3, BigInteger::from_integer(-7)), std::invalid_argument);
+        REQUIRE_THROWS_AS(BigInteger::pow_mod(BigInteger::two(), BigInteger::from_integer(-1), BigInteger::from_integer(7)),
+                          std::invalid_argument);
+        REQUIRE_THROWS_AS(BigInteger::MontgomeryContext(BigInteger::from_integer(10)), std::invalid_argument);
+    }
+}
+
+TEST_CASE("BigInteger roots and perfect powers", "[BigInteger][sqrt][nth_root]") {
+    std::mt19937 gen(1111);
+
+    SECTION("Square root with remainder") {
+        for (std::size_t length: {1, 5, 19, 20, 39, 40, 100, 1000, 12000}) {
+            for (int i = 0; i < 5; ++i) {
+                BigInteger n = BigInteger::parse(randomDecimalString(gen, length));
+                auto [s, r] = BigInteger::sqrt_rem(n);
+                REQUIRE(s * s + r == n);
+                REQUIRE(r >= BigInteger::zero());
+                REQUIRE(r <= s * BigInteger::two());
+                REQUIRE(BigInteger::sqrt(n) == s);
+
+                auto [exactRoot, zeroRemainder] = BigInteger::sqrt_rem(s * s);
+                REQUIRE(exactRoot == s);
+                REQUIRE(zeroRemainder == BigInteger::zero());
+                REQUIRE(BigInteger::sqrt(s * s - BigInteger::one()) == s - BigInteger::one());
+            }
+        }
+
+        for (std::uint64_t v: {0ULL, 1ULL, 2ULL, 3ULL, 4ULL, 99ULL, 100ULL, 4294967295ULL, 4294967296ULL,
+                               18446744073709551615ULL}) {
+            auto [s, r] = BigInteger::sqrt_rem(BigInteger::from_integer(v));
+            auto root = static_cast<std::uint64_t>(*s.to<std::uint64_t>());
+            REQUIRE(root * root + *r.to<std::uint64_t>() == v);
+        }
+        REQUIRE_THROWS_AS(BigInteger::sqrt_rem(BigInteger::from_integer(-4)), std::runtime_error);
+    }
+
+    SECTION("Integer k-th roots") {
+        for (unsigned int k: {1u, 2u, 3u, 5u, 7u, 16u, 100u}) {
+            for (std::size_t length: {3, 30, 300, 3000}) {
+                BigInteger n = BigInteger::parse(randomDecimalString(gen, length));
+                BigInteger root = BigInteger::nth_root(n, k);
+                REQUIRE(BigInteger::pow(root, k) <= n);
+                REQUIRE(BigInteger::pow(root + BigInteger::one(), k) > n);
+                REQUIRE(BigInteger::nth_root(BigInteger::pow(root, k), k) == root);
+            }
+        }
+        REQUIRE(BigInteger::nth_root(BigInteger::from_integer(-27), 3) == BigInteger::from_integer(-3));
+        REQUIRE(BigInteger::nth_root(BigInteger::from_integer(-30), 3) == BigInteger::from_integer(-3));
+        REQUIRE(BigInteger::nth_root(BigInteger::zero(), 5) == BigInteger::zero());
+        REQUIRE(BigInteger::nth_root(BigInteger::from_integer(31), 5) == BigInteger::one());
+        REQUIRE(BigInteger::nth_root(BigInteger::from_integer(32), 5) == BigInteger::two());
+        REQUIRE_THROWS_AS(BigInteger::nth_root(BigInteger::from_integer(-16), 4), std::runtime_error);
+        REQUIRE_THROWS_AS(BigInteger::nth_root(BigInteger::from_integer(16), 0), std::invalid_argument);
+    }
+
+    SECTION("Perfect powers") {
+        for (int v: {0, 1, -1, 4, 8, -8, 9, 16, 27, -27, 32, 36, 49, 64, 81, 100, 125, 128, 1024}) {
+            REQUIRE(BigInteger::is_perfect_power(BigInteger::from_integer(v)));
+        }
+        for (int v: {2, 3, 5, 6, 10, 12, 18, 24, 99, 101, -4, -2, -32 * 3, 1000001}) {
+            REQUIRE_FALSE(BigInteger::is_perfect_power(BigInteger::from_integer(v)));
+        }
+
+        BigInteger base = BigInteger::parse(randomDecimalString(gen, 40));
+        for (unsigned int k: {2u, 3u, 6u, 11u}) {
+            BigInteger power = BigInteger::pow(base, k);
+            REQUIRE(BigInteger::is_perfect_power(power));
+            REQUIRE_FALSE(BigInteger::is_perfect_power(power + BigInteger::one()));
+        }
+        REQUIRE(BigInteger::is_perfect_power(-BigInteger::pow(base, 3)));
+        REQUIRE_FALSE(BigInteger::is_perfect_power(-BigInteger::pow(base * base, 1)));
+        REQUIRE(BigInteger::is_perfect_power(BigInteger::one() << 97));
+        REQUIRE_FALSE(BigInteger::is_perfect_power((BigInteger::one() << 97) * BigInteger::from_integer(3)));
+    }
+
+    SECTION("Perfect powers with small roots and large exponents") {
+        // Every value up to 20000 against the powers enumerated directly
+        std::vector<bool> isPower(20001, false);
+        for (long long root = 2; root * root <= 20000; ++root) {
+            for (long long power = root * root; power <= 20000; power *= root) {
+                isPower[static_cast<std::size_t>(power)] = true;
+            }
+        }
+        for (int v = 2; v <= 20000; ++v) {
+            REQUIRE(BigInteger::is_perfect_power(BigInteger::from_integer(v)) == isPower[static_cast<std::size_t>(v)]);
+        }
+
+        for (auto [root, k]: std::vector<std::pair<std::uint64_t, unsigned int>>{
+                 {3, 1001}, {12345, 97}, {6, 210}, {1099511627689ULL, 31}, {1099511627776ULL - 1, 5},
+                 {4398046511093ULL, 23}, {999999999989ULL, 2}}) {
+            BigInteger power = BigInteger::pow(BigInteger::from_integer(root), k);
+            REQUIRE(BigInteger::is_perfect_power(power));
+            REQUIRE_FALSE(BigInteger::is_perfect_power(power + BigInteger::two()));
+            REQUIRE_FALSE(BigInteger::is_perfect_power(power - BigInteger::two()));
+            if (k % 2 == 1) {
+                REQUIRE(BigInteger::is_perfect_power(-power));
+            }
+        }
+        REQUIRE(BigInteger::is_perfect_power(-BigInteger::pow(BigInteger::from_integer(7), 3 * 5 * 7 * 11)));
+        REQUIRE_FALSE(BigInteger::is_perfect_power(-BigInteger::pow(BigInteger::from_integer(7), 2 * 64)));
+    }
+}
+
+TEST_CASE("BigInteger factorial and binomial", "[BigInteger][factorial][binomial]") {
+    SECTION("Prime swing factorial matches the sequential product") {
+        BigInteger expected = BigInteger::one();
+        for (unsigned int n = 0; n <= 600; ++n) {
+            if (n > 0) {
+                expected *= BigInteger::from_integer(n);
+            }
+            REQUIRE(BigInteger::factorial(n) == expected);
+        }
+        REQUIRE(BigInteger::factorial(20).to_string() == "2432902008176640000");
+        REQUIRE(BigInteger::factorial(21).to_string() == "51090942171709440000");
+    }
+
+    SECTION("Large factorials") {
+        BigInteger f = BigInteger::factorial(5000);
+        REQUIRE(f.to_string().size() == 16326);
+        REQUIRE(f / BigInteger::factorial(4999) == BigInteger::from_integer(5000));
+        // 5000! ends in 1249 zeros
+        REQUIRE(f % BigInteger::parse("1" + std::string(1249, '0')) == BigInteger::zero());
+        REQUIRE(f % BigInteger::parse("1" + std::string(1250, '0')) != BigInteger::zero());
+    }
+
+    SECTION("Binomial coefficients") {
+        for (unsigned int n = 0; n <= 60; ++n) {
+            BigInteger row = BigInteger::one();
+            for (unsigned int k = 0; k <= n; ++k) {
+                REQUIRE(BigInteger::binomial(n, k) == row);
+                row = row * BigInteger::from_integer(n - k) / BigInteger::from_integer(k + 1);
+            }
+            REQUIRE(BigInteger::binomial(n, n + 1) == BigInteger::zero());
+        }
+        REQUIRE(BigInteger::binomial(100, 50).to_string() == "100891344545564193334812497256");
+        // Bounds beyond the int range of the prime sieve are rejected instead of truncated
+        REQUIRE_THROWS_AS(BigInteger::factorial(3000000000u), std::length_error);
+        REQUIRE_THROWS_AS(BigInteger::binomial(4000000000u, 5), std::length_error);
+        REQUIRE(BigInteger::binomial(3000, 1200) ==
+                BigInteger::factorial(3000) / (BigInteger::factorial(1200) * BigInteger::factorial(1800)));
+    }
+}
+
+TEST_CASE("BigInteger parallel multiplication", "[BigInteger][Multiplication][Parallel]") {
+    std::mt19937 gen(1313);
+
+    SECTION("Matches the serial product for every algorithm") {
+        // Toom-3 range, NTT range and an unbalanced product split into slices
+        for (auto [la, lb]: {std::pair<std::size_t, std::size_t>{25000, 25000}, {60000, 55000}, {200000, 22000}}) {
+            BigInteger a = BigInteger::parse(randomDecimalString(gen, la));
+            BigInteger b = -BigInteger::parse(randomDecimalString(gen, lb));
+            BigInteger expected = a * b;
+            for (unsigned int threads: {1u, 2u, 3u, 8u}) {
+                REQUIRE(BigInteger::multiply(a, b, threads) == expected);
+                REQUIRE(BigInteger::multiply(b, a, threads) == expected);
+            }
+            REQUIRE(BigInteger::multiply(a, a, 4) == a * a);
+        }
+    }
+
+    SECTION("Small operands and the default thread count") {
+        BigInteger a = BigInteger::parse(randomDecimalString(gen, 500));
+        BigInteger b = BigInteger::parse(randomDecimalString(gen, 300));
+        REQUIRE(BigInteger::multiply(a, b, 0) == a * b);
+        REQUIRE(BigInteger::multiply(a, BigInteger::zero(), 4) == BigInteger::zero());
+        REQUIRE(BigInteger::multiply(BigInteger::from_integer(-6), BigInteger::from_integer(7), 4) ==
+                BigInteger::from_integer(-42));
+    }
+}
+
+namespace {
+    std::vector<std::uint32_t> limbsOf(const BigInteger &x) {
+        const BigInteger mask = BigInteger::from_integer(0xFFFFFFFFu);
+        std::vector<std::uint32_t> result;
+        for (BigInteger rest = x.abs(); rest != BigInteger::zero(); rest >>= 32) {
+            result.push_back(*(rest & mask).to<std::uint32_t>());
+        }
+        return result;
+    }
+
+    BigInteger fromLimbs(const std::vector<std::uint32_t> &limbs) {
+        BigInteger result = BigInteger::zero();
+        for (std::size_t i = limbs.size(); i-- > 0;) {
+            result = (result << 32) | BigInteger::from_integer(limbs[i]);
+        }
+        return result;
+    }
+
+    // Limb by limb reference for |a| + |b| and |a| - |b| (requires |a| >= |b|), independent of the add/sub kernels
+    BigInteger referenceAddOrSubtract(const BigInteger &a, const BigInteger &b, bool subtract) {
+        std::vector<std::uint32_t> x = limbsOf(a);
+        std::vector<std::uint32_t> y = limbsOf(b);
+        std::vector<std::uint32_t> r(std::max(x.size(), y.size()) + 1, 0);
+        std::int64_t carry = 0;
+        for (std::size_t i = 0; i + 1 < r.size(); ++i) {
+            std::int64_t xi = i < x.size() ? x[i] : 0;
+            std::int64_t yi = i < y.size() ? y[i] : 0;
+            std::int64_t t = subtract ? xi - yi + carry : xi + yi + carry;
+            r[i] = static_cast<std::uint32_t>(t);
+            carry = t >> 32;
+        }
+        r.back() = static_cast<std::uint32_t>(carry);
+        return fromLimbs(r);
+    }
+
+    // Mostly all-ones or all-zero limbs, so that carries and borrows run through whole vector blocks
+    BigInteger carryChainPattern(std::mt19937 &gen, int limbs) {
+        std::vector<std::uint32_t> result(static_cast<std::size_t>(limbs));
+        const std::uint32_t fill = gen() % 2 == 0 ? 0xFFFFFFFFu : 0u;
+        for (std::uint32_t &limb: result) {
+            limb = gen() % 8 == 0 ? static_cast<std::uint32_t>(gen()) : fill;
+        }
+        result.back() |= 1;
+        return fromLimbs(result);
+    }
+}
+
+TEST_CASE("BigInteger vectorized limb kernels", "[BigInteger][Addition][Subtraction][SIMD]") {
+    std::mt19937 gen(1414);
+
+    SECTION("Addition and subtraction against a limb by limb reference") {
+        for (int i = 0; i < 600; ++i) {
+            const int na = 1 + static_cast<int>(gen() % 70);
+            const int nb = 1 + static_cast<int>(gen() % 70);
+            BigInteger a = i % 2 == 0 ? carryChainPattern(gen, na) : randomLimbPattern(gen, na);
+            BigInteger b = i % 3 == 0 ? carryChainPattern(gen, nb) : randomLimbPattern(gen, nb);
+            REQUIRE(a + b == referenceAddOrSubtract(a, b, false));
+            if (a < b) {
+                std::swap(a, b);
+            }
+            REQUIRE(a - b == referenceAddOrSubtract(a, b, true));
+            REQUIRE(b - a == -referenceAddOrSubtract(a, b, true));
+        }
+    }
+
+    SECTION("Carries and borrows across every block boundary") {
+        for (std::size_t bits = 32; bits <= 32 * 70; bits += 32) {
+            const BigInteger power = BigInteger::one() << bits;
+            const BigInteger ones = power - BigInteger::one();
+            REQUIRE(ones.popcount() == bits);
+            REQUIRE(ones + BigInteger::one() == power);
+            REQUIRE(ones + ones == (power << 1) - BigInteger::two());
+            REQUIRE(power - ones == BigInteger::one());
+        }
+    }
+
+    SECTION("Magnitude comparison locates the highest differing limb") {
+        for (int limbs: {1, 7, 8, 9, 16, 17, 33, 64, 100}) {
+            BigInteger a = randomLimbPattern(gen, limbs) | (BigInteger::one() << (32 * limbs - 1));
+            for (int position = 0; position < limbs; ++position) {
+                const BigInteger step = BigInteger::one() << (32 * position);
+                REQUIRE(a < a + step);
+                REQUIRE(a + step > a);
+                REQUIRE(-a > -(a + step));
+                REQUIRE(a == (a + step) - step);
+            }
+        }
+    }
+}
+
+TEST_CASE("BigInteger fused multiply-add", "[BigInteger][addmul][submul]") {
+    std::mt19937 gen(1515);
+    auto randomSigned = [&](int limbs) {
+        BigInteger x = randomLimbPattern(gen, limbs);
+        return gen() % 2 == 0 ? x : -x;
+    };
+
+    SECTION("Matches the separate product and sum") {
+        for (int i = 0; i < 1500; ++i) {
+            BigInteger r = randomSigned(static_cast<int>(gen() % 12));
+            BigInteger a = randomSigned(1 + static_cast<int>(gen() % 10));
+            BigInteger b = randomSigned(1 + static_cast<int>(gen() % (i % 10 == 0 ? 60 : 6)));
+
+            BigInteger sum = r;
+            REQUIRE(sum.addmul(a, b) == r + a * b);
+            BigInteger difference = r;
+            REQUIRE(difference.submul(a, b) == r - a * b);
+        }
+    }
+
+    SECTION("Results that cancel or change sign") {
+        BigInteger a = BigInteger::parse("123456789012345678901234567890");
+        BigInteger b = BigInteger::parse("-98765432109876543210");
+        BigInteger r = a * b;
+        REQUIRE(r.submul(a, b) == BigInteger::zero());
+        REQUIRE(r.to_string() == "0");
+
+        r = BigInteger::one();
+        REQUIRE(r.addmul(a, b) == a * b + BigInteger::one());
+        REQUIRE(r.submul(a, -b) == BigInteger::two() * a * b + BigInteger::one());
+        REQUIRE(r.addmul(a, BigInteger::zero()) == BigInteger::two() * a * b + BigInteger::one());
+    }
+
+    SECTION("Aliased and large operands") {
+        BigInteger a = randomSigned(80);
+        BigInteger b = randomSigned(50);
+        BigInteger r = a;
+        REQUIRE(r.addmul(r, b) == a + a * b);
+        r = a;
+        REQUIRE(r.submul(b, r) == a - a * b);
+        r = randomSigned(30);
+        BigInteger expected = r - a * b;
+        REQUIRE(r.submul(a, b) == expected);
+    }
+}
+
+namespace {
+    // Forwards to the global heap and keeps track of what is currently allocated through it
+    class CountingResource : public std::pmr::memory_resource {
+    public:
+        std::size_t allocations = 0;
+        std::size_t outstandingBytes = 0;
+
+    private:
+        void *do_allocate(std::size_t bytes, std::size_t alignment) override {
+            ++allocations;
+            outstandingBytes += bytes;
+            return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+        }
+
+        void do_deallocate(void *p, std::size_t bytes, std::size_t alignment) override {
+            outstandingBytes -= bytes;
+            std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+        }
+
+        [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override {
+            return this == &other;
+        }
+    };
+}
+
+TEST_CASE("BigInteger memory resources", "[BigInteger][pmr]") {
+    std::mt19937 gen(1616);
+    const std::string digits = randomDecimalString(gen, 400);
+    const BigInteger reference = BigInteger::parse(digits);
+
+    SECTION("Values and their derived results allocate from the resource") {
+        CountingResource counting;
+        {
+            BigInteger x = BigInteger::parse(digits, &counting);
+            REQUIRE(x == reference);
+            REQUIRE(x.resource() == &counting);
+            const std::size_t before = counting.allocations;
+            REQUIRE(before > 0);
+
+            BigInteger y = x * x + x - BigInteger::from_integer(7);
+            BigInteger q = y / (x + BigInteger::one());
+            BigInteger r = y % reference;
+            REQUIRE(y.resource() == &counting);
+            REQUIRE(q.resource() == &counting);
+            REQUIRE(r.resource() == &counting);
+            REQUIRE((-q).resource() == &counting);
+            REQUIRE((q << 100).resource() == &counting);
+            REQUIRE((q & y).resource() == &counting);
+            REQUIRE(counting.allocations > before);
+            REQUIRE(y == reference * reference + reference - BigInteger::from_integer(7));
+
+            // Assignment keeps the resource of the target
+            BigInteger global = BigInteger::zero();
+            global = y * y;
+            REQUIRE(global.resource() == std::pmr::new_delete_resource());
+            REQUIRE(global == y * y);
+            BigInteger moved = std::move(y);
+            REQUIRE(moved.resource() == &counting);
+
+            BigInteger small = BigInteger::from_integer(-12345, &counting);
+            REQUIRE(small.resource() == &counting);
+            REQUIRE(BigInteger(reference, nullptr).resource() == std::pmr::new_delete_resource());
+        }
+        REQUIRE(counting.outstandingBytes == 0);
+    }
+
+    SECTION("A monotonic arena per batch") {
+        BigInteger expected = BigInteger::one();
+        for (unsigned int i = 1; i <= 300; ++i) {
+            expected *= BigInteger::from_integer(i);
+        }
+
+        std::pmr::monotonic_buffer_resource arena;
+        BigInteger product = BigInteger::from_integer(1, &arena);
+        for (unsigned int i = 1; i <= 300; ++i) {
+            product = product * BigInteger::from_integer(i, &arena);
+        }
+        REQUIRE(product == expected);
+        REQUIRE(product.resource() == &arena);
+        REQUIRE(BigInteger::zero().resource() == std::pmr::new_delete_resource());
+    }
+
+    SECTION("Copies outlive the arena of their source") {
+        std::optional<BigInteger> copy;
+        {
+            std::pmr::monotonic_buffer_resource arena;
+            BigInteger scoped = BigInteger::parse(digits, &arena) * BigInteger::from_integer(3, &arena);
+            REQUIRE(scoped.resource() == &arena);
+            copy.emplace(scoped);
+            REQUIRE(BigInteger(scoped, &arena).resource() == &arena);
+        }
+        REQUIRE(copy->resource() == std::pmr::new_delete_resource());
+        REQUIRE(*copy == reference * BigInteger::from_integer(3));
+        REQUIRE(copy->to_string() == (reference * BigInteger::from_integer(3)).to_string());
+    }
+}
+
+TEST_CASE("BigInteger binary import, export and serialization", "[BigInteger][Serialization]") {
+    std::mt19937 gen(1717);
+
+    SECTION("Byte export and import") {
+        REQUIRE(BigInteger::zero().export_bytes().empty());
+        REQUIRE(BigInteger::import_bytes({}, true) == BigInteger::zero());
+
+        std::vector<std::byte> bytes = BigInteger::from_integer(0x0102030405LL).export_bytes();
+        REQUIRE(bytes == std::vector<std::byte>{std::byte{5}, std::byte{4}, std::byte{3}, std::byte{2}, std::byte{1}});
+        REQUIRE(BigInteger::from_integer(-255).byte_length() == 1);
+        REQUIRE(BigInteger::from_integer(256).byte_length() == 2);
+
+        // Leading zero bytes are accepted
+        bytes.resize(12, std::byte{0});
+        REQUIRE(BigInteger::import_bytes(bytes, true) == BigInteger::from_integer(-0x0102030405LL));
+
+        for (std::size_t length: {1, 9, 10, 100, 5000}) {
+            BigInteger x = BigInteger::parse(randomDecimalString(gen, length));
+            std::vector<std::byte> out = x.export_bytes();
+            REQUIRE(out.size() == x.byte_length());
+            REQUIRE(BigInteger::import_bytes(out) == x);
+            REQUIRE(BigInteger::import_bytes(out, true) == -x);
+        }
+
+        std::byte small[2];
+        REQUIRE_THROWS_AS(BigInteger::from_integer(1 << 20).export_bytes(small), std::length_error);
+        REQUIRE(BigInteger::from_integer(0x1234).export_bytes(small) == 2);
+        REQUIRE(small[0] == std::byte{0x34});
+        REQUIRE(small[1] == std::byte{0x12});
+    }
+
+    SECTION("Serialized records round-trip and concatenate") {
+        std::vector<BigInteger> values = {BigInteger::zero(), BigInteger::one(), BigInteger::from_integer(-1),
+                                          BigInteger::getMinValueInstance<long long>()};
+        for (std::size_t length: {30, 300, 20000}) {
+            values.push_back(BigInteger::parse(randomDecimalString(gen, length)));
+            values.push_back(-values.back());
+        }
+
+        std::vector<std::byte> stream;
+        for (const BigInteger &value: values) {
+            value.serialize(stream);
+        }
+        // 20000 digits take 2077 limbs, so the header (2 * 2077 + 1) needs two varint bytes
+        REQUIRE(values.back().serialize().size() == 4 * ((values.back().bit_length() + 31) / 32) + 2);
+
+        std::span<const std::byte> rest = stream;
+        for (const BigInteger &value: values) {
+            std::size_t consumed = 0;
+            REQUIRE(BigInteger::deserialize(rest, &consumed) == value);
+            rest = rest.subspan(consumed);
+        }
+        REQUIRE(rest.empty());
+    }
+
+    SECTION("Zero and negative zero round-trip") {
+        for (const BigInteger &zero: {BigInteger::zero(), -BigInteger::zero(), BigInteger::parse("-0")}) {
+            std::vector<std::byte> bytes = zero.export_bytes();
+            REQUIRE(bytes.empty());
+            REQUIRE(zero.export_bytes(std::span<std::byte>()) == 0);
+            REQUIRE(BigInteger::import_bytes(bytes) == BigInteger::zero());
+            REQUIRE(BigInteger::import_bytes(bytes, true).to_string() == "0");
+
+            std::vector<std::byte> record = zero.serialize();
+            REQUIRE(record.size() == 1);
+            std::size_t consumed = 0;
+            BigInteger restored = BigInteger::deserialize(record, &consumed);
+            REQUIRE(consumed == 1);
+            REQUIRE(restored == BigInteger::zero());
+            REQUIRE(restored.to_string() == "0");
+        }
+    }
+
+    SECTION("Malformed records") {
+        std::vector<std::byte> record = BigInteger::parse("123456789012345678901234567890").serialize();
+        REQUIRE_THROWS_AS(BigInteger::deserialize(std::span<const std::byte>(record).first(record.size() - 1)),
+                          std::invalid_argument);
+        REQUIRE_THROWS_AS(BigInteger::deserialize({}), std::invalid_argument);
+        std::vector<std::byte> overlong(11, std::byte{0xFF});
+        REQUIRE_THROWS_AS(BigInteger::deserialize(overlong), std::invalid_argument);
+    }
+}
+
+TEST_CASE("BigInteger floating-point conversion", "[BigInteger][double]") {
+    std::mt19937 gen(1818);
+
+    SECTION("to_double is correctly rounded") {
+        for (std::size_t length: {1, 5, 15, 16, 17, 19, 20, 25, 40, 100, 300, 308}) {
+            for (int i = 0; i < 50; ++i) {
+                const std::string digits = randomDecimalString(gen, length);
+                const BigInteger x = BigInteger::parse(digits);
+                REQUIRE(x.to_double() == std::strtod(digits.c_str(), nullptr));
+                REQUIRE((-x).to_double() == -std::strtod(digits.c_str(), nullptr));
+            }
+        }
+
+        // Exact halfway cases round to even; anything above the midpoint rounds up
+        const BigInteger base = BigInteger::one() << 80;
+        const BigInteger halfUlp = BigInteger::one() << (80 - 53);
+        REQUIRE((base + halfUlp).to_double() == std::ldexp(1.0, 80));
+        REQUIRE((base + halfUlp + BigInteger::one()).to_double() == std::ldexp(1.0, 80) + std::ldexp(1.0, 80 - 52));
+        REQUIRE((base + halfUlp * BigInteger::from_integer(3)).to_double() == std::ldexp(1.0, 80) + std::ldexp(1.0, 80 - 51));
+
+        REQUIRE(BigInteger::zero().to_double() == 0.0);
+        REQUIRE(((BigInteger::one() << 1024) - BigInteger::one()).to_double() == std::numeric_limits<double>::infinity());
+        REQUIRE((-(BigInteger::one() << 1023)).to_double() == -std::ldexp(1.0, 1023));
+        REQUIRE((-(BigInteger::one() << 5000)).to_double() == -std::numeric_limits<double>::infinity());
+    }
+
+    SECTION("frexp splits mantissa and exponent") {
+        auto [m, e] = BigInteger::from_integer(-12).frexp();
+        REQUIRE(m == -0.75);
+        REQUIRE(e == 4);
+
+        auto [hm, he] = (BigInteger::one() << 100000).frexp();
+        REQUIRE(hm == 0.5);
+        REQUIRE(he == 100001);
+
+        // Rounding up to the next power of two renormalizes the mantissa
+        auto [rm, re] = ((BigInteger::one() << 200) - BigInteger::one()).frexp();
+        REQUIRE(rm == 0.5);
+        REQUIRE(re == 201);
+
+        auto [zm, ze] = BigInteger::zero().frexp();
+        REQUIRE(zm == 0.0);
+        REQUIRE(ze == 0);
+    }
+
+    SECTION("from_double is exact for integral values and truncates fractions") {
+        REQUIRE(BigInteger::from_double(0.0) == BigInteger::zero());
+        REQUIRE(BigInteger::from_double(-0.75) == BigInteger::zero());
+        REQUIRE(BigInteger::from_double(2.9) == BigInteger::two());
+        REQUIRE(BigInteger::from_double(-2.9) == BigInteger::from_integer(-2));
+        REQUIRE(BigInteger::from_double(9007199254740993.0) == BigInteger::parse("9007199254740992"));
+        REQUIRE(BigInteger::from_double(std::ldexp(1.0, 1000)) == BigInteger::one() << 1000);
+        REQUIRE(BigInteger::from_double(-1e300).to_double() == -1e300);
+        REQUIRE(BigInteger::from_double(std::numeric_limits<double>::max()).to_double() ==
+                std::numeric_limits<double>::max());
+
+        for (int i = 0; i < 1000; ++i) {
+            const double value = std::ldexp(static_cast<double>(gen()) + 0.5, static_cast<int>(gen() % 200) - 40);
+            REQUIRE(BigInteger::from_double(value).to_double() == std::trunc(value));
+        }
+
+        REQUIRE_THROWS_AS(BigInteger::from_double(std::numeric_limits<double>::infinity()), std::invalid_argument);
+        REQUIRE_THROWS_AS(BigInteger::from_double(std::numeric_limits<double>::quiet_NaN()), std::invalid_argument);
+    }
+}
+
+TEST_CASE("BigInteger cached powers of ten", "[BigInteger][log10][PowerOfTen]") {
+    SECTION("log10 matches the digit count around powers of ten") {
+        for (std::size_t k : {1u, 9u, 15u, 16u, 17u, 18u, 19u, 20u, 100u, 1000u, 4321u, 20000u}) {
+            BigInteger power = BigInteger::parse("1" + std::string(k, '0'));
+            REQUIRE(BigInteger::log10(power).to_string() == std::to_string(k));
+            REQUIRE(BigInteger::log10(power - BigInteger::one()).to_string() == std::to_string(k - 1));
+            REQUIRE(BigInteger::log10(power + BigInteger::one()).to_string() == std::to_string(k));
+        }
+
+        std::mt19937_64 rng(19);
+        for (int i = 0; i < 50; ++i) {
+            std::string digits(1 + rng() % 3000, '0');
+            for (char &c : digits) {
+                c = static_cast<char>('0' + rng() % 10);
+            }
+            digits[0] = static_cast<char>('1' + rng() % 9);
+            BigInteger number = BigInteger::parse(digits);
+            REQUIRE(BigInteger::log10(number).to_string() == std::to_string(digits.size() - 1));
+        }
+    }
+
+    SECTION("Large powers of ten round-trip through multiply and divide") {
+        BigInteger number = BigInteger::parse("-123456789012345678901234567890");
+        for (std::size_t power : {359u, 360u, 1000u, 12345u}) {
+            BigInteger scaled = number;
+            scaled.multiplyByPowerOfTen(power);
+            REQUIRE(scaled.to_string() == number.to_string() + std::string(power, '0'));
+            scaled.divideByPowerOfTen(power);
+            REQUIRE(scaled == number);
+            scaled.multiplyByPowerOfTen(power);
+            scaled.divideByPowerOfTen(power + 20);
+            REQUIRE(scaled.to_string() == "-1234567890");
+            scaled.divideByPowerOfTen(power * 10);
+            REQUIRE(scaled.to_string() == "0");
+        }
+    }
+
+    SECTION("Concurrent conversions share the cache") {
+        std::string digits(60000, '0');
+        for (std::size_t i = 0; i < digits.size(); ++i) {
+            digits[i] = static_cast<char>('0' + (i * 7 + 3) % 10);
+        }
+        std::vector<std::string> results(4);
+        std::vector<std::thread> workers;
+        for (std::size_t t = 0; t < results.size(); ++t) {
+            workers.emplace_back([&, t] {
+                results[t] = BigInteger::parse(digits.substr(0, digits.size() - t)).to_string();
+            });
+        }
+        for (auto &worker : workers) {
+            worker.join();
+        }
+        for (std::size_t t = 0; t < results.size(); ++t) {
+            REQUIRE(results[t] == digits.substr(0, digits.size() - t));
+        }
+    }
+
+    SECTION("Concurrent conversions of different sizes") {
+        // Each worker needs powers the others are computing at the same time, some with and some without reciprocals
+        std::string digits(120000, '0');
+        for (std::size_t i = 0; i < digits.size(); ++i) {
+            digits[i] = static_cast<char>('1' + (i * 11 + 5) % 9);
+        }
+        const std::vector<std::size_t> lengths = {120000, 2000, 90000, 500, 30000, 70000};
+        std::vector<std::string> results(lengths.size());
+        std::vector<BigInteger> powers(lengths.size(), BigInteger::one());
+        std::vector<std::thread> workers;
+        for (std::size_t t = 0; t < lengths.size(); ++t) {
+            workers.emplace_back([&, t] {
+                results[t] = BigInteger::parse(digits.substr(0, lengths[t])).to_string();
+                powers[t].multiplyByPowerOfTen(lengths[t]);
+            });
+        }
+        for (auto &worker : workers) {
+            worker.join();
+        }
+        for (std::size_t t = 0; t < lengths.size(); ++t) {
+            REQUIRE(results[t] == digits.substr(0, lengths[t]));
+            REQUIRE(powers[t].to_string() == "1" + std::string(lengths[t], '0'));
+        }
+    }
+}
@@ -1,5 +1,12 @@
 #include <catch2/catch_test_macros.hpp>
 #include "rational_number.hpp"
+#include <memory_resource>
+#include <random>
+#include <limits>
+#include <vector>
+#include <algorithm>
+#include <compare>
+#include <ranges>
 using namespace hsc_snippets;
 
 TEST_CASE("rational_number.hpp", "[RationalNumber]") {
@@ -112,4 +119,229 @@ TEST_CASE("rational_number.hpp", "[RationalNumber]") {
         REQUIRE(r_one.getNominator() == BigInteger::one());
         REQUIRE(r_one.getDenominator() == BigInteger::one());
     }
+
+    SECTION("Test memory resource propagation") {
+        std::pmr::monotonic_buffer_resource arena;
+        RationalNumber sum = RationalNumber::create(BigInteger::zero(), BigInteger::one(), &arena);
+        RationalNumber expected = RationalNumber::zero();
+        for (int i = 1; i <= 60; ++i) {
+            RationalNumber term = RationalNumber::create(BigInteger::one(), BigInteger::from_integer(i));
+            sum += term;
+            expected += term;
+        }
+        REQUIRE(sum == expected);
+        REQUIRE(sum.resource() == &arena);
+        REQUIRE(sum.getNominator().resource() == &arena);
+        REQUIRE(sum.getDenominator().resource() == &arena);
+        REQUIRE((sum * sum - sum).resource() == &arena);
+        REQUIRE((-sum).resource() == &arena);
+        REQUIRE(sum.inverse().resource() == &arena);
+        REQUIRE(RationalNumber(sum).resource() == std::pmr::new_delete_resource());
+        REQUIRE(expected.resource() == std::pmr::new_delete_resource());
+    }
+
+    SECTION("Test lazy normalization") {
+        RationalNumber lazySum = RationalNumber::zero();
+        lazySum.set_lazy(true);
+        RationalNumber eagerSum = RationalNumber::zero();
+        for (int i = 1; i <= 200; ++i) {
+            RationalNumber term = RationalNumber::create(BigInteger::from_integer(i % 7 == 0 ? -1 : 1),
+                                                         BigInteger::from_integer(i));
+            lazySum += term;
+            eagerSum += term;
+            REQUIRE(lazySum.is_lazy());
+        }
+        REQUIRE(eagerSum.is_normalized());
+        REQUIRE_FALSE(lazySum.is_normalized());
+        REQUIRE(lazySum == eagerSum);
+        REQUIRE(lazySum.is_normalized());
+        REQUIRE(lazySum.to_string() == eagerSum.to_string());
+
+        // The unreduced value is reduced when its parts are observed. Fractions beyond 64 bits are needed here
+        // because small ones take the int64 path, which always reduces.
+        RationalNumber tiny = RationalNumber::create(BigInteger::one(), BigInteger::one() << 80);
+        tiny.set_lazy(true);
+        RationalNumber twice = tiny + tiny;
+        REQUIRE_FALSE(twice.is_normalized());
+        REQUIRE(twice.getDenominator() == BigInteger::one() << 79);
+        REQUIRE(twice.is_normalized());
+
+        RationalNumber half = RationalNumber::create(BigInteger::one(), BigInteger::from_integer(2));
+        half.set_lazy(true);
+        RationalNumber one = half + half;
+        REQUIRE(one.getNominator() == BigInteger::one());
+        REQUIRE(one.getDenominator() == BigInteger::one());
+
+        RationalNumber three = half + half + half + half + half + half;
+        three.normalize();
+        REQUIRE(three.is_normalized());
+        REQUIRE(three.to_string() == "3/1");
+
+        RationalNumber zero = half - half;
+        REQUIRE(zero == RationalNumber::zero());
+        REQUIRE((zero * half).to_string() == "0/1");
+
+        RationalNumber quarter = half * half;
+        quarter.set_lazy(false);
+        REQUIRE_FALSE(quarter.is_lazy());
+        REQUIRE((quarter + quarter).is_normalized());
+        REQUIRE((-(half + half)).to_string() == "-1/1");
+        REQUIRE((half + half).inverse().to_string() == "1/1");
+        REQUIRE((half - half - half).abs().to_string() == "1/2");
+    }
+
+    SECTION("Test cross-cancellation in multiplication and division") {
+        RationalNumber a = RationalNumber::create(BigInteger::from_integer(6), BigInteger::from_integer(35));
+        RationalNumber b = RationalNumber::create(BigInteger::from_integer(-14), BigInteger::from_integer(9));
+        REQUIRE((a * b).to_string() == "-4/15");
+        REQUIRE((a / b).to_string() == "-27/245");
+        REQUIRE((b / a).to_string() == "-245/27");
+        REQUIRE((a * a.inverse()).to_string() == "1/1");
+        REQUIRE((a * RationalNumber::zero()).to_string() == "0/1");
+        REQUIRE((RationalNumber::zero() / b).to_string() == "0/1");
+        REQUIRE((a * b).is_normalized());
+
+        RationalNumber product = RationalNumber::one();
+        for (int k = 1; k <= 100; ++k) {
+            product *= RationalNumber::create(BigInteger::from_integer(k + 1), BigInteger::from_integer(k + 2));
+        }
+        REQUIRE(product.to_string() == "1/51");
+    }
+
+    SECTION("Test 64-bit fast path against BigInteger arithmetic") {
+        std::mt19937_64 rng(23);
+        auto randomPart = [&](bool nonZero) {
+            // Mix tiny parts with ones close to 2^63, whose results must be promoted
+            std::int64_t magnitudes[] = {7, 1000003, std::numeric_limits<std::int64_t>::max()};
+            std::int64_t value = static_cast<std::int64_t>(rng() % static_cast<std::uint64_t>(magnitudes[rng() % 3]));
+            if (nonZero && value == 0) {
+                value = 1;
+            }
+            return rng() % 2 == 0 ? value : -value;
+        };
+        for (int i = 0; i < 2000; ++i) {
+            BigInteger n1 = BigInteger::from_integer(randomPart(false));
+            BigInteger d1 = BigInteger::from_integer(randomPart(true));
+            BigInteger n2 = BigInteger::from_integer(randomPart(false));
+            BigInteger d2 = BigInteger::from_integer(randomPart(true));
+            RationalNumber a = RationalNumber::create(n1, d1);
+            RationalNumber b = RationalNumber::create(n2, d2);
+
+            REQUIRE((a + b).to_string() == RationalNumber::create(n1 * d2 + n2 * d1, d1 * d2).to_string());
+            REQUIRE((a - b).to_string() == RationalNumber::create(n1 * d2 - n2 * d1, d1 * d2).to_string());
+            REQUIRE((a * b).to_string() == RationalNumber::create(n1 * n2, d1 * d2).to_string());
+            if (n2 != BigInteger::zero()) {
+                REQUIRE((a / b).to_string() == RationalNumber::create(n1 * d2, d1 * n2).to_string());
+            }
+
+            BigInteger lhs = n1 * d2 * d1 * d2;
+            BigInteger rhs = n2 * d1 * d1 * d2;
+            REQUIRE((a < b) == (lhs < rhs));
+            REQUIRE((a >= b) == (lhs >= rhs));
+        }
+
+        RationalNumber max = RationalNumber::create(BigInteger::from_integer(std::numeric_limits<std::int64_t>::max()));
+        REQUIRE((max + max).to_string() == "18446744073709551614/1");
+        REQUIRE((max * max).to_string() == "85070591730234615847396907784232501249/1");
+        REQUIRE((max * max / max).to_string() == "9223372036854775807/1");
+        RationalNumber min = RationalNumber::create(BigInteger::from_integer(std::numeric_limits<std::int64_t>::min()));
+        REQUIRE((min - RationalNumber::one()).to_string() == "-9223372036854775809/1");
+        REQUIRE(min < max);
+    }
+
+    SECTION("Test comparisons and three-way ordering") {
+        std::mt19937_64 rng(24);
+        auto randomInteger = [&](bool nonZero) {
+            std::string digits(1 + rng() % 60, '0');
+            for (char &c : digits) {
+                c = static_cast<char>('0' + rng() % 10);
+            }
+            BigInteger value = BigInteger::parse(digits);
+            if (nonZero && value == BigInteger::zero()) {
+                value = BigInteger::one();
+            }
+            return rng() % 2 == 0 ? value : -value;
+        };
+        auto referenceOrder = [](const RationalNumber &a, const RationalNumber &b) {
+            BigInteger lhs = a.getNominator() * b.getDenominator();
+            BigInteger rhs = b.getNominator() * a.getDenominator();
+            return lhs < rhs ? -1 : (lhs > rhs ? 1 : 0);
+        };
+
+        std::vector<RationalNumber> values;
+        for (int i = 0; i < 300; ++i) {
+            RationalNumber value = RationalNumber::create(randomInteger(false), randomInteger(true));
+            values.push_back(value);
+            // A neighbour that agrees with it far beyond double precision
+            BigInteger tiny = BigInteger::pow(BigInteger::from_integer(10), 80) * value.getDenominator();
+            values.push_back(value + RationalNumber::create(BigInteger::one(), rng() % 2 == 0 ? tiny : -tiny));
+        }
+        for (const RationalNumber &a : values) {
+            for (std::size_t j = 0; j < 40; ++j) {
+                const RationalNumber &b = values[rng() % values.size()];
+                const int expected = referenceOrder(a, b);
+                REQUIRE((a < b) == (expected < 0));
+                REQUIRE((a <= b) == (expected <= 0));
+                REQUIRE((a > b) == (expected > 0));
+                REQUIRE((a >= b) == (expected >= 0));
+                REQUIRE((a <=> b) == (expected <=> 0));
+            }
+        }
+
+        std::sort(values.begin(), values.end());
+        for (std::size_t i = 1; i < values.size(); ++i) {
+            REQUIRE(referenceOrder(values[i - 1], values[i]) <= 0);
+        }
+        REQUIRE(std::binary_search(values.begin(), values.end(), values[values.size() / 2]));
+
+        // Equal values in unreduced lazy form compare equal without being normalized
+        RationalNumber third = RationalNumber::create(BigInteger::one(), BigInteger::from_integer(3) << 70);
+        third.set_lazy(true);
+        RationalNumber sum = third + third;
+        RationalNumber expected = RationalNumber::create(BigInteger::from_integer(2), BigInteger::from_integer(3) << 70);
+        REQUIRE((sum <=> expected) == std::strong_ordering::equal);
+        REQUIRE_FALSE(sum.is_normalized());
+        REQUIRE((RationalNumber::zero() <=> -expected) == std::strong_ordering::greater);
+        REQUIRE((-sum <=> RationalNumber::zero()) == std::strong_ordering::less);
+    }
+
+    SECTION("Test balanced sum and product of ranges") {
+        auto fraction = [](long long n, long long d) {
+            return RationalNumber::create(BigInteger::from_integer(n), BigInteger::from_integer(d));
+        };
+
+        std::vector<RationalNumber> harmonic;
+        RationalNumber expected = RationalNumber::zero();
+        for (int k = 1; k <= 300; ++k) {
+            harmonic.push_back(fraction(k % 5 == 0 ? -1 : 1, k));
+            expected += harmonic.back();
+        }
+        RationalNumber total = RationalNumber::sum(harmonic);
+        REQUIRE(total.is_normalized());
+        REQUIRE(total.to_string() == expected.to_string());
+
+        // Terms over a common denominator, as in probability aggregation
+        std::vector<RationalNumber> probabilities(1000, fraction(1, 6000));
+        REQUIRE(RationalNumber::sum(probabilities).to_string() == "1/6");
+
+        // Any input range whose elements convert to RationalNumber works, including generated ones
+        auto telescoping = std::views::iota(1, 501) | std::views::transform([&](int k) {
+            return fraction(k + 1, k + 2);
+        });
+        REQUIRE(RationalNumber::product(telescoping).to_string() == "1/251");
+
+        std::vector<RationalNumber> factors;
+        RationalNumber expectedProduct = RationalNumber::one();
+        for (int k = 1; k <= 200; ++k) {
+            factors.push_back(fraction(2 * k + 1, 3 * k - 1));
+            expectedProduct *= factors.back();
+        }
+        REQUIRE(RationalNumber::product(factors).to_string() == expectedProduct.to_string());
+
+        std::vector<RationalNumber> empty;
+        REQUIRE(RationalNumber::sum(empty) == RationalNumber::zero());
+        REQUIRE(RationalNumber::product(empty) == RationalNumber::one());
+        REQUIRE(RationalNumber::sum(std::vector<RationalNumber>{fraction(-3, 4)}).to_string() == "-3/4");
+        REQUIRE(RationalNumber::product(std::vector<RationalNumber>{fraction(2, 3), RationalNumber::zero()}).to_string() == "0/1");
+    }
 }